@@ -28,6 +28,7 @@
 #include <llvm/ADT/SmallVector.h>
 #include <llvm/ADT/StringMap.h>
 #include <map>
+#include <phasar/Utils/SmallVectorSet.h>
 #include <set>
 #include <unordered_map>
 #include <unordered_set>
@@ -43,8 +44,7 @@ template <typename T> using ICFGSet = boost::container::flat_set<T>;
 // define the set implementation to use for the flow functions ----------------
 #define FFSetPreAllocSize 10
 
-template <typename T>
-using FFSet = boost::container::small_vector<T, FFSetPreAllocSize>;
+template <typename T> using FFSet = SmallVectorSet<T, FFSetPreAllocSize>;
 // ----------------------------------------------------------------------------
 
 // define the map implementation to use for the special summaries -------------
@@ -10,6 +10,8 @@
 #ifndef ANALYSISCONTROLLER_HH_
 #define ANALYSISCONTROLLER_HH_
 
+#include <atomic>
+#include <exception>
 #include <iostream>
 #include <json.hpp>
 #include <llvm/Analysis/AliasAnalysis.h>
@@ -24,6 +26,7 @@
 #include <phasar/PhasarLLVM/ControlFlow/LLVMBasedCFG.h>
 #include <phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h>
 #include <phasar/PhasarLLVM/IfdsIde/IDESummaries.h>
+#include <phasar/PhasarLLVM/IfdsIde/IFDSProductProblem.h>
 #include <phasar/PhasarLLVM/IfdsIde/LLVMZeroValue.h>
 #include <phasar/PhasarLLVM/IfdsIde/Problems/IDELinearConstantAnalysis.h>
 #include <phasar/PhasarLLVM/IfdsIde/Problems/IDESolverTest.h>
@@ -37,12 +40,14 @@
 #include <phasar/PhasarLLVM/IfdsIde/Problems/IFDSUninitializedVariables.h>
 #include <phasar/PhasarLLVM/IfdsIde/Solver/LLVMIDESolver.h>
 #include <phasar/PhasarLLVM/IfdsIde/Solver/LLVMIFDSSolver.h>
+#include <phasar/PhasarLLVM/IfdsIde/Solver/MultiEntryPointSolver.h>
 #include <phasar/PhasarLLVM/Mono/Problems/InterMonotoneSolverTest.h>
 #include <phasar/PhasarLLVM/Mono/Problems/IntraMonoFullConstantPropagation.h>
 #include <phasar/PhasarLLVM/Mono/Problems/IntraMonotoneSolverTest.h>
 #include <phasar/PhasarLLVM/Plugins/AnalysisPluginController.h>
 #include <phasar/PhasarLLVM/Utils/DataFlowAnalysisType.h>
 #include <phasar/Utils/SOL.h>
+#include <thread>
 #include <vector>
 
 using json = nlohmann::json;
@@ -17,9 +17,11 @@
 #ifndef ANALYSIS_IFDS_IDE_EDGEFUNCTION_H_
 #define ANALYSIS_IFDS_IDE_EDGEFUNCTION_H_
 
+#include <cstddef>
 #include <iostream>
 #include <memory>
 #include <string>
+#include <typeinfo>
 
 namespace psr {
 
@@ -37,6 +39,15 @@ public:
 
   virtual bool equalTo(std::shared_ptr<EdgeFunction<V>> other) = 0;
 
+  /**
+   * Hash value used to hash-cons edge functions, see EdgeFunctionFactory.
+   * Edge functions that are equalTo each other must have the same hash
+   * value. Edge functions that carry parameters should override it and
+   * combine their parameters into the hash value, otherwise all of them end
+   * up in the same bucket and the factory logs a warning.
+   */
+  virtual size_t hash() { return typeid(*this).hash_code(); }
+
   virtual void dump() { std::cout << "edge function\n"; }
 
   virtual std::string toString() { return "edge function"; }
@@ -0,0 +1,284 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef ANALYSIS_IFDS_IDE_EDGEFUNCTIONFACTORY_H_
+#define ANALYSIS_IFDS_IDE_EDGEFUNCTIONFACTORY_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <phasar/PhasarLLVM/IfdsIde/EdgeFunction.h>
+#include <phasar/Utils/Logger.h>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace psr {
+
+template <typename V> class EdgeFunctionFactory;
+
+/**
+ * Refers to a canonical edge function that is owned by an EdgeFunctionFactory.
+ * Copying a reference is as cheap as copying a raw pointer, the reference
+ * count of the edge function is not touched. References remain valid as long
+ * as the factory that handed them out is alive. Two references are equal if
+ * and only if they refer to edge functions that are equalTo each other.
+ */
+template <typename V> class EdgeFunctionRef {
+private:
+  const std::shared_ptr<EdgeFunction<V>> *Slot = nullptr;
+
+  explicit EdgeFunctionRef(const std::shared_ptr<EdgeFunction<V>> *Slot)
+      : Slot(Slot) {}
+
+  friend class EdgeFunctionFactory<V>;
+
+public:
+  EdgeFunctionRef() = default;
+
+  EdgeFunction<V> *get() const { return Slot ? Slot->get() : nullptr; }
+
+  EdgeFunction<V> *operator->() const { return Slot->get(); }
+
+  EdgeFunction<V> &operator*() const { return **Slot; }
+
+  /// Returns the owning pointer, e.g. to call composeWith() or joinWith().
+  const std::shared_ptr<EdgeFunction<V>> &ptr() const { return *Slot; }
+
+  explicit operator bool() const { return Slot != nullptr; }
+
+  /// Returns a raw value from which the reference can be restored, e.g. to
+  /// store the reference outside of the heap.
+  const void *getOpaqueValue() const { return Slot; }
+
+  static EdgeFunctionRef getFromOpaqueValue(const void *Value) {
+    return EdgeFunctionRef(
+        static_cast<const std::shared_ptr<EdgeFunction<V>> *>(Value));
+  }
+
+  friend bool operator==(EdgeFunctionRef Lhs, EdgeFunctionRef Rhs) {
+    return Lhs.Slot == Rhs.Slot;
+  }
+
+  friend bool operator!=(EdgeFunctionRef Lhs, EdgeFunctionRef Rhs) {
+    return Lhs.Slot != Rhs.Slot;
+  }
+
+  friend bool operator<(EdgeFunctionRef Lhs, EdgeFunctionRef Rhs) {
+    return std::less<const void *>()(Lhs.Slot, Rhs.Slot);
+  }
+
+  friend std::ostream &operator<<(std::ostream &os, EdgeFunctionRef Ref) {
+    return os << (Ref ? Ref->toString() : "null");
+  }
+};
+
+/**
+ * Hash-conses edge functions and memoizes their compositions and joins.
+ *
+ * Edge functions that are equalTo each other are mapped to a single canonical
+ * instance. The canonical instances are owned by the factory, which acts as
+ * the region the solver allocates its edge functions in: they are released
+ * all at once when the factory is destroyed. The solver refers to them by
+ * EdgeFunctionRef and thus never touches their reference counts. The results
+ * of compose() and join() are memoized per pair of canonical arguments; the
+ * memoization is bounded and forgets all of its entries once it is full.
+ *
+ * The factory may be used from multiple threads.
+ *
+ * @param <V> The type of values computed by the edge functions.
+ */
+template <typename V> class EdgeFunctionFactory {
+public:
+  using EdgeFunctionPtr = std::shared_ptr<EdgeFunction<V>>;
+  using Ref = EdgeFunctionRef<V>;
+
+private:
+  struct InternShard {
+    std::mutex Mutex;
+    // owns the canonical edge functions, a deque never moves its elements
+    std::deque<EdgeFunctionPtr> Slots;
+    std::unordered_map<size_t, std::vector<const EdgeFunctionPtr *>> Buckets;
+  };
+
+  struct MemoKey {
+    const EdgeFunction<V> *First;
+    const EdgeFunction<V> *Second;
+    bool IsJoin;
+    bool operator==(const MemoKey &Other) const {
+      return First == Other.First && Second == Other.Second &&
+             IsJoin == Other.IsJoin;
+    }
+  };
+
+  struct MemoKeyHash {
+    size_t operator()(const MemoKey &Key) const {
+      size_t H = std::hash<const void *>()(Key.First);
+      H = H * 31 + std::hash<const void *>()(Key.Second);
+      return H * 2 + Key.IsJoin;
+    }
+  };
+
+  struct MemoShard {
+    std::mutex Mutex;
+    std::unordered_map<MemoKey, Ref, MemoKeyHash> Results;
+  };
+
+  std::vector<std::unique_ptr<InternShard>> InternShards;
+  std::vector<std::unique_ptr<MemoShard>> MemoShards;
+  size_t MaxMemoShardSize;
+  std::atomic<size_t> NumFunctions;
+  std::atomic<size_t> MemoHits;
+  std::atomic<size_t> MemoMisses;
+
+  /// Logs once per type of edge function whose distinct instances end up in
+  /// the same bucket, which most likely means that the type does not
+  /// override EdgeFunction::hash() although it carries parameters.
+  static void warnCollision(const EdgeFunction<V> &F) {
+    static std::mutex WarnedMutex;
+    static std::unordered_set<std::type_index> Warned;
+    {
+      std::lock_guard<std::mutex> Lock(WarnedMutex);
+      if (!Warned.insert(typeid(F)).second) {
+        return;
+      }
+    }
+    auto &lg = lg::get();
+    BOOST_LOG_SEV(lg, WARNING)
+        << "Distinct edge functions of type " << typeid(F).name()
+        << " have the same hash value, they are compared one by one when "
+           "interned; override EdgeFunction::hash()";
+  }
+
+  Ref compute(Ref First, Ref Second, bool IsJoin) {
+    return intern(IsJoin ? First->joinWith(Second.ptr())
+                         : First->composeWith(Second.ptr()));
+  }
+
+  Ref memoized(Ref First, Ref Second, bool IsJoin) {
+    if (MaxMemoShardSize == 0) {
+      ++MemoMisses;
+      return compute(First, Second, IsJoin);
+    }
+    // the arguments are owned by the factory, hence their addresses cannot
+    // be reused for other edge functions
+    MemoKey Key{First.get(), Second.get(), IsJoin};
+    MemoShard &S = *MemoShards[MemoKeyHash()(Key) % MemoShards.size()];
+    {
+      std::lock_guard<std::mutex> Lock(S.Mutex);
+      auto Search = S.Results.find(Key);
+      if (Search != S.Results.end()) {
+        ++MemoHits;
+        return Search->second;
+      }
+    }
+    ++MemoMisses;
+    Ref Result = compute(First, Second, IsJoin);
+    std::lock_guard<std::mutex> Lock(S.Mutex);
+    if (S.Results.size() >= MaxMemoShardSize) {
+      S.Results.clear();
+    }
+    S.Results.emplace(Key, Result);
+    return Result;
+  }
+
+public:
+  /**
+   * MaxMemoSize bounds the number of memoized compositions and joins, 0
+   * disables the memoization. NumShards is the number of independently
+   * locked partitions of the tables.
+   */
+  explicit EdgeFunctionFactory(size_t MaxMemoSize = 65536,
+                               size_t NumShards = 1)
+      : NumFunctions(0), MemoHits(0), MemoMisses(0) {
+    NumShards = std::max<size_t>(NumShards, 1);
+    for (size_t I = 0; I < NumShards; ++I) {
+      InternShards.push_back(std::make_unique<InternShard>());
+      MemoShards.push_back(std::make_unique<MemoShard>());
+    }
+    MaxMemoShardSize =
+        (MaxMemoSize == 0) ? 0 : std::max<size_t>(MaxMemoSize / NumShards, 1);
+  }
+
+  ~EdgeFunctionFactory() = default;
+
+  EdgeFunctionFactory(const EdgeFunctionFactory &) = delete;
+  EdgeFunctionFactory &operator=(const EdgeFunctionFactory &) = delete;
+
+  /// Returns the canonical instance of the given edge function.
+  Ref intern(const EdgeFunctionPtr &F) {
+    size_t H = F->hash();
+    InternShard &S = *InternShards[H % InternShards.size()];
+    std::lock_guard<std::mutex> Lock(S.Mutex);
+    std::vector<const EdgeFunctionPtr *> &Bucket = S.Buckets[H];
+    for (const EdgeFunctionPtr *Canonical : Bucket) {
+      if (*Canonical == F) {
+        return Ref(Canonical);
+      }
+    }
+    for (const EdgeFunctionPtr *Canonical : Bucket) {
+      if ((*Canonical)->equalTo(F)) {
+        return Ref(Canonical);
+      }
+    }
+    if (!Bucket.empty() && typeid(**Bucket.front()) == typeid(*F)) {
+      warnCollision(*F);
+    }
+    S.Slots.push_back(F);
+    Bucket.push_back(&S.Slots.back());
+    ++NumFunctions;
+    return Ref(&S.Slots.back());
+  }
+
+  /// Constructs an edge function and returns its canonical instance.
+  template <typename EF, typename... Args> Ref make(Args &&... A) {
+    return intern(std::make_shared<EF>(std::forward<Args>(A)...));
+  }
+
+  /// Returns the canonical instance of First->composeWith(Second).
+  Ref compose(Ref First, Ref Second) { return memoized(First, Second, false); }
+
+  Ref compose(Ref First, const EdgeFunctionPtr &Second) {
+    return memoized(First, intern(Second), false);
+  }
+
+  /// Returns the canonical instance of First->joinWith(Second).
+  Ref join(Ref First, Ref Second) { return memoized(First, Second, true); }
+
+  Ref join(Ref First, const EdgeFunctionPtr &Second) {
+    return memoized(First, intern(Second), true);
+  }
+
+  /// Forgets all memoized compositions and joins.
+  void clearMemo() {
+    for (auto &S : MemoShards) {
+      std::lock_guard<std::mutex> Lock(S->Mutex);
+      S->Results.clear();
+    }
+  }
+
+  /// Returns the number of distinct edge functions.
+  size_t size() const { return NumFunctions; }
+
+  size_t getMemoHits() const { return MemoHits; }
+
+  size_t getMemoMisses() const { return MemoMisses; }
+};
+
+} // namespace psr
+
+#endif /* ANALYSIS_IFDS_IDE_EDGEFUNCTIONFACTORY_H_ */
@@ -10,15 +10,20 @@
 #ifndef FLOWEDGEFUNCTIONCACHE_H_
 #define FLOWEDGEFUNCTIONCACHE_H_
 
-#include <map>
+#include <boost/functional/hash.hpp>
+#include <functional>
 #include <memory>
 #include <phasar/PhasarLLVM/IfdsIde/EdgeFunction.h>
 #include <phasar/PhasarLLVM/IfdsIde/FlowFunction.h>
 #include <phasar/PhasarLLVM/IfdsIde/IDETabulationProblem.h>
+#include <phasar/PhasarLLVM/IfdsIde/SolverConfiguration.h>
 #include <phasar/PhasarLLVM/IfdsIde/ZeroedFlowFunction.h>
+#include <phasar/Utils/ConcurrentLRUCache.h>
 #include <phasar/Utils/Logger.h>
-#include <phasar/Utils/PAMM.h>
+#include <set>
+#include <string>
 #include <tuple>
+#include <utility>
 
 namespace psr {
 
@@ -27,309 +32,275 @@ namespace psr {
  * When a flow or edge function must be applied to multiple times, a cached
  * version is used if existend, otherwise a new one is created and inserted
  * into the cache.
+ *
+ * The caches are hash tables that are split into the given number of shards,
+ * which the solver derives from the number of threads it actually uses, such
+ * that they may be queried concurrently, and
+ * hold at most flowEdgeFunctionCacheSize functions of each kind, see
+ * SolverConfiguration. The least recently used functions are evicted first.
  */
 template <typename N, typename D, typename M, typename V, typename I>
 struct FlowEdgeFunctionCache {
+  // Hashes the elements of a tuple using their std::hash specializations
+  struct TupleHash {
+    template <typename... Ts>
+    size_t operator()(const std::tuple<Ts...> &Key) const {
+      return hashElements(Key, std::index_sequence_for<Ts...>());
+    }
+    template <typename Tuple, size_t... Is>
+    static size_t hashElements(const Tuple &Key, std::index_sequence<Is...>) {
+      size_t H = 0;
+      using Expand = int[];
+      (void)Expand{0, (boost::hash_combine(
+                           H, std::hash<std::tuple_element_t<Is, Tuple>>()(
+                                  std::get<Is>(Key))),
+                       0)...};
+      return H;
+    }
+  };
+
+  // Call-to-return flow functions are keyed by the set of callees, whose
+  // hash is computed once per lookup and compared before the sets are
+  struct CallToRetKey {
+    N CallSite;
+    N RetSite;
+    size_t CalleesHash;
+    std::set<M> Callees;
+    CallToRetKey(N CallSite, N RetSite, std::set<M> Callees)
+        : CallSite(CallSite), RetSite(RetSite), CalleesHash(0),
+          Callees(std::move(Callees)) {
+      for (M Callee : this->Callees) {
+        boost::hash_combine(CalleesHash, std::hash<M>()(Callee));
+      }
+    }
+    bool operator==(const CallToRetKey &Other) const {
+      return CallSite == Other.CallSite && RetSite == Other.RetSite &&
+             CalleesHash == Other.CalleesHash && Callees == Other.Callees;
+    }
+  };
+
+  struct CallToRetKeyHash {
+    size_t operator()(const CallToRetKey &Key) const {
+      return TupleHash()(std::make_tuple(Key.CallSite, Key.RetSite)) ^
+             Key.CalleesHash;
+    }
+  };
+
+  using FlowFunctionPtr = std::shared_ptr<FlowFunction<D>>;
+  using EdgeFunctionPtr = std::shared_ptr<EdgeFunction<V>>;
+  template <typename Key, typename Value, typename Hash = TupleHash>
+  using Cache = ConcurrentLRUCache<Key, Value, Hash>;
+
   IDETabulationProblem<N, D, M, V, I> &problem;
   // Auto add zero
   bool autoAddZero;
   D zeroValue;
   // Caches for the flow functions
-  std::map<std::tuple<N, N>, std::shared_ptr<FlowFunction<D>>>
-      NormalFlowFunctionCache;
-  std::map<std::tuple<N, M>, std::shared_ptr<FlowFunction<D>>>
-      CallFlowFunctionCache;
-  std::map<std::tuple<N, M, N, N>, std::shared_ptr<FlowFunction<D>>>
-      ReturnFlowFunctionCache;
-  std::map<std::tuple<N, N, std::set<M>>, std::shared_ptr<FlowFunction<D>>>
+  Cache<std::tuple<N, N>, FlowFunctionPtr> NormalFlowFunctionCache;
+  Cache<std::tuple<N, M>, FlowFunctionPtr> CallFlowFunctionCache;
+  Cache<std::tuple<N, M, N, N>, FlowFunctionPtr> ReturnFlowFunctionCache;
+  Cache<CallToRetKey, FlowFunctionPtr, CallToRetKeyHash>
       CallToRetFlowFunctionCache;
+  Cache<std::tuple<N, M>, FlowFunctionPtr> SummaryFlowFunctionCache;
   // Caches for the edge functions
-  std::map<std::tuple<N, D, N, D>, std::shared_ptr<EdgeFunction<V>>>
-      NormalEdgeFunctionCache;
-  std::map<std::tuple<N, D, M, D>, std::shared_ptr<EdgeFunction<V>>>
-      CallEdgeFunctionCache;
-  std::map<std::tuple<N, M, N, D, N, D>, std::shared_ptr<EdgeFunction<V>>>
-      ReturnEdgeFunctionCache;
-  std::map<std::tuple<N, D, N, D>, std::shared_ptr<EdgeFunction<V>>>
-      CallToRetEdgeFunctionCache;
-  std::map<std::tuple<N, D, N, D>, std::shared_ptr<EdgeFunction<V>>>
-      SummaryEdgeFunctionCache;
+  Cache<std::tuple<N, D, N, D>, EdgeFunctionPtr> NormalEdgeFunctionCache;
+  Cache<std::tuple<N, D, M, D>, EdgeFunctionPtr> CallEdgeFunctionCache;
+  Cache<std::tuple<N, M, N, D, N, D>, EdgeFunctionPtr> ReturnEdgeFunctionCache;
+  Cache<std::tuple<N, D, N, D>, EdgeFunctionPtr> CallToRetEdgeFunctionCache;
+  Cache<std::tuple<N, D, N, D>, EdgeFunctionPtr> SummaryEdgeFunctionCache;
+
+  FlowFunctionPtr addZero(FlowFunctionPtr ff) const {
+    return (autoAddZero)
+               ? std::make_shared<ZeroedFlowFunction<D>>(ff, zeroValue)
+               : ff;
+  }
 
   // Ctor allows access to the IDEProblem in order to get access to flow and
-  // edge function factory functions.
-  FlowEdgeFunctionCache(IDETabulationProblem<N, D, M, V, I> &problem)
+  // edge function factory functions. Solvers that query the cache from
+  // several threads pass the number of shards they need.
+  FlowEdgeFunctionCache(IDETabulationProblem<N, D, M, V, I> &problem,
+                        size_t numShards = 1)
       : problem(problem), autoAddZero(problem.solver_config.autoAddZero),
-        zeroValue(problem.zeroValue()) {
-    PAMM_FACTORY;
-    REG_COUNTER("Normal-FF Construction");
-    REG_COUNTER("Normal-FF Cache Hit");
-    // Counters for the call flow functions
-    REG_COUNTER("Call-FF Construction");
-    REG_COUNTER("Call-FF Cache Hit");
-    // Counters for return flow functions
-    REG_COUNTER("Return-FF Construction");
-    REG_COUNTER("Return-FF Cache Hit");
-    // Counters for the call to return flow functions
-    REG_COUNTER("CallToRet-FF Construction");
-    REG_COUNTER("CallToRet-FF Cache Hit");
-    // Counters for the summary flow functions
-    // REG_COUNTER("Summary-FF Construction");
-    // REG_COUNTER("Summary-FF Cache Hit");
-    // Counters for the normal edge functions
-    REG_COUNTER("Normal-EF Construction");
-    REG_COUNTER("Normal-EF Cache Hit");
-    // Counters for the call edge functions
-    REG_COUNTER("Call-EF Construction");
-    REG_COUNTER("Call-EF Cache Hit");
-    // Counters for the return edge functions
-    REG_COUNTER("Return-EF Construction");
-    REG_COUNTER("Return-EF Cache Hit");
-    // Counters for the call to return edge functions
-    REG_COUNTER("CallToRet-EF Construction");
-    REG_COUNTER("CallToRet-EF Cache Hit");
-    // Counters for the summary edge functions
-    REG_COUNTER("Summary-EF Construction");
-    REG_COUNTER("Summary-EF Cache Hit");
+        zeroValue(problem.zeroValue()),
+        NormalFlowFunctionCache(
+            problem.solver_config.flowEdgeFunctionCacheSize,
+            numShards),
+        CallFlowFunctionCache(problem.solver_config.flowEdgeFunctionCacheSize,
+                              numShards),
+        ReturnFlowFunctionCache(
+            problem.solver_config.flowEdgeFunctionCacheSize,
+            numShards),
+        CallToRetFlowFunctionCache(
+            problem.solver_config.flowEdgeFunctionCacheSize,
+            numShards),
+        SummaryFlowFunctionCache(
+            problem.solver_config.flowEdgeFunctionCacheSize,
+            numShards),
+        NormalEdgeFunctionCache(
+            problem.solver_config.flowEdgeFunctionCacheSize,
+            numShards),
+        CallEdgeFunctionCache(problem.solver_config.flowEdgeFunctionCacheSize,
+                              numShards),
+        ReturnEdgeFunctionCache(
+            problem.solver_config.flowEdgeFunctionCacheSize,
+            numShards),
+        CallToRetEdgeFunctionCache(
+            problem.solver_config.flowEdgeFunctionCacheSize,
+            numShards),
+        SummaryEdgeFunctionCache(
+            problem.solver_config.flowEdgeFunctionCacheSize,
+            numShards) {}
+
+  FlowFunctionPtr getNormalFlowFunction(N curr, N succ) {
+    return NormalFlowFunctionCache.getOrCompute(
+        std::make_tuple(curr, succ),
+        [&] { return addZero(problem.getNormalFlowFunction(curr, succ)); });
   }
 
-  std::shared_ptr<FlowFunction<D>> getNormalFlowFunction(N curr, N succ) {
-    PAMM_FACTORY;
-    auto key = std::tie(curr, succ);
-    if (NormalFlowFunctionCache.count(key)) {
-      INC_COUNTER("Normal-FF Cache Hit");
-      return NormalFlowFunctionCache.at(key);
-    } else {
-      INC_COUNTER("Normal-FF Construction");
-      auto ff = (autoAddZero)
-                    ? std::make_shared<ZeroedFlowFunction<D>>(
-                          problem.getNormalFlowFunction(curr, succ), zeroValue)
-                    : problem.getNormalFlowFunction(curr, succ);
-      NormalFlowFunctionCache.insert(make_pair(key, ff));
-      return ff;
-    }
+  FlowFunctionPtr getCallFlowFunction(N callStmt, M destMthd) {
+    return CallFlowFunctionCache.getOrCompute(
+        std::make_tuple(callStmt, destMthd), [&] {
+          return addZero(problem.getCallFlowFunction(callStmt, destMthd));
+        });
   }
 
-  std::shared_ptr<FlowFunction<D>> getCallFlowFunction(N callStmt, M destMthd) {
-    PAMM_FACTORY;
-    auto key = std::tie(callStmt, destMthd);
-    if (CallFlowFunctionCache.count(key)) {
-      INC_COUNTER("Call-FF Cache Hit");
-      return CallFlowFunctionCache.at(key);
-    } else {
-      INC_COUNTER("Call-FF Construction");
-      auto ff =
-          (autoAddZero)
-              ? std::make_shared<ZeroedFlowFunction<D>>(
-                    problem.getCallFlowFunction(callStmt, destMthd), zeroValue)
-              : problem.getCallFlowFunction(callStmt, destMthd);
-      CallFlowFunctionCache.insert(make_pair(key, ff));
-      return ff;
-    }
+  FlowFunctionPtr getRetFlowFunction(N callSite, M calleeMthd, N exitStmt,
+                                     N retSite) {
+    return ReturnFlowFunctionCache.getOrCompute(
+        std::make_tuple(callSite, calleeMthd, exitStmt, retSite), [&] {
+          return addZero(problem.getRetFlowFunction(callSite, calleeMthd,
+                                                    exitStmt, retSite));
+        });
   }
 
-  std::shared_ptr<FlowFunction<D>> getRetFlowFunction(N callSite, M calleeMthd,
-                                                      N exitStmt, N retSite) {
-    PAMM_FACTORY;
-    auto key = std::tie(callSite, calleeMthd, exitStmt, retSite);
-    if (ReturnFlowFunctionCache.count(key)) {
-      INC_COUNTER("Return-FF Cache Hit");
-      return ReturnFlowFunctionCache.at(key);
-    } else {
-      INC_COUNTER("Return-FF Construction");
-      auto ff = (autoAddZero)
-                    ? std::make_shared<ZeroedFlowFunction<D>>(
-                          problem.getRetFlowFunction(callSite, calleeMthd,
-                                                     exitStmt, retSite),
-                          zeroValue)
-                    : problem.getRetFlowFunction(callSite, calleeMthd, exitStmt,
-                                                 retSite);
-      ReturnFlowFunctionCache.insert(make_pair(key, ff));
-      return ff;
-    }
+  FlowFunctionPtr getCallToRetFlowFunction(N callSite, N retSite,
+                                           std::set<M> callees) {
+    CallToRetKey key(callSite, retSite, std::move(callees));
+    return CallToRetFlowFunctionCache.getOrCompute(key, [&] {
+      return addZero(
+          problem.getCallToRetFlowFunction(callSite, retSite, key.Callees));
+    });
   }
 
-  std::shared_ptr<FlowFunction<D>>
-  getCallToRetFlowFunction(N callSite, N retSite, std::set<M> callees) {
-    PAMM_FACTORY;
-    auto key = std::tie(callSite, retSite, callees);
-    if (CallToRetFlowFunctionCache.count(key)) {
-      INC_COUNTER("CallToRet-FF Cache Hit");
-      return CallToRetFlowFunctionCache.at(key);
-    } else {
-      INC_COUNTER("CallToRet-FF Construction");
-      auto ff =
-          (autoAddZero)
-              ? std::make_shared<ZeroedFlowFunction<D>>(
-                    problem.getCallToRetFlowFunction(callSite, retSite,
-                                                     callees),
-                    zeroValue)
-              : problem.getCallToRetFlowFunction(callSite, retSite, callees);
-      CallToRetFlowFunctionCache.insert(make_pair(key, ff));
-      return ff;
-    }
+  /// Returns the summary flow function or nullptr if the problem does not
+  /// provide one, both of which are cached.
+  FlowFunctionPtr getSummaryFlowFunction(N callStmt, M destMthd) {
+    return SummaryFlowFunctionCache.getOrCompute(
+        std::make_tuple(callStmt, destMthd),
+        [&] { return problem.getSummaryFlowFunction(callStmt, destMthd); });
   }
 
-  std::shared_ptr<FlowFunction<D>> getSummaryFlowFunction(N callStmt,
-                                                          M destMthd) {
-    PAMM_FACTORY;
-    // INC_COUNTER("Summary-FF Construction");
-    auto ff = problem.getSummaryFlowFunction(callStmt, destMthd);
-    return ff;
+  EdgeFunctionPtr getNormalEdgeFunction(N curr, D currNode, N succ,
+                                        D succNode) {
+    return NormalEdgeFunctionCache.getOrCompute(
+        std::make_tuple(curr, currNode, succ, succNode), [&] {
+          return problem.getNormalEdgeFunction(curr, currNode, succ, succNode);
+        });
   }
 
-  std::shared_ptr<EdgeFunction<V>> getNormalEdgeFunction(N curr, D currNode,
-                                                         N succ, D succNode) {
-    PAMM_FACTORY;
-    auto key = std::tie(curr, currNode, succ, succNode);
-    if (NormalEdgeFunctionCache.count(key)) {
-      INC_COUNTER("Normal-EF Cache Hit");
-      return NormalEdgeFunctionCache.at(key);
-    } else {
-      INC_COUNTER("Normal-EF Construction");
-      auto ef = problem.getNormalEdgeFunction(curr, currNode, succ, succNode);
-      NormalEdgeFunctionCache.insert(make_pair(key, ef));
-      return ef;
-    }
+  EdgeFunctionPtr getCallEdgeFunction(N callStmt, D srcNode,
+                                      M destiantionMethod, D destNode) {
+    return CallEdgeFunctionCache.getOrCompute(
+        std::make_tuple(callStmt, srcNode, destiantionMethod, destNode), [&] {
+          return problem.getCallEdgeFunction(callStmt, srcNode,
+                                             destiantionMethod, destNode);
+        });
   }
 
-  std::shared_ptr<EdgeFunction<V>>
-  getCallEdgeFunction(N callStmt, D srcNode, M destiantionMethod, D destNode) {
-    PAMM_FACTORY;
-    auto key = std::tie(callStmt, srcNode, destiantionMethod, destNode);
-    if (CallEdgeFunctionCache.count(key)) {
-      INC_COUNTER("Call-EF Cache Hit");
-      return CallEdgeFunctionCache.at(key);
-    } else {
-      INC_COUNTER("Call-EF Construction");
-      auto ef = problem.getCallEdgeFunction(callStmt, srcNode,
-                                            destiantionMethod, destNode);
-      CallEdgeFunctionCache.insert(make_pair(key, ef));
-      return ef;
-    }
+  EdgeFunctionPtr getReturnEdgeFunction(N callSite, M calleeMethod,
+                                        N exitStmt, D exitNode, N reSite,
+                                        D retNode) {
+    return ReturnEdgeFunctionCache.getOrCompute(
+        std::make_tuple(callSite, calleeMethod, exitStmt, exitNode, reSite,
+                        retNode),
+        [&] {
+          return problem.getReturnEdgeFunction(callSite, calleeMethod,
+                                               exitStmt, exitNode, reSite,
+                                               retNode);
+        });
   }
 
-  std::shared_ptr<EdgeFunction<V>> getReturnEdgeFunction(N callSite,
-                                                         M calleeMethod,
-                                                         N exitStmt, D exitNode,
-                                                         N reSite, D retNode) {
-    PAMM_FACTORY;
-    auto key =
-        std::tie(callSite, calleeMethod, exitStmt, exitNode, reSite, retNode);
-    if (ReturnEdgeFunctionCache.count(key)) {
-      INC_COUNTER("Return-EF Cache Hit");
-      return ReturnEdgeFunctionCache.at(key);
-    } else {
-      INC_COUNTER("Return-EF Construction");
-      auto ef = problem.getReturnEdgeFunction(callSite, calleeMethod, exitStmt,
-                                              exitNode, reSite, retNode);
-      ReturnEdgeFunctionCache.insert(make_pair(key, ef));
-      return ef;
-    }
+  EdgeFunctionPtr getCallToReturnEdgeFunction(N callSite, D callNode,
+                                              N retSite, D retSiteNode) {
+    return CallToRetEdgeFunctionCache.getOrCompute(
+        std::make_tuple(callSite, callNode, retSite, retSiteNode), [&] {
+          return problem.getCallToReturnEdgeFunction(callSite, callNode,
+                                                     retSite, retSiteNode);
+        });
   }
 
-  std::shared_ptr<EdgeFunction<V>> getCallToReturnEdgeFunction(N callSite,
-                                                               D callNode,
-                                                               N retSite,
-                                                               D retSiteNode) {
-    PAMM_FACTORY;
-    auto key = std::tie(callSite, callNode, retSite, retSiteNode);
-    if (CallToRetEdgeFunctionCache.count(key)) {
-      INC_COUNTER("CallToRet-EF Cache Hit");
-      return CallToRetEdgeFunctionCache.at(key);
-    } else {
-      INC_COUNTER("CallToRet-EF Construction");
-      auto ef = problem.getCallToReturnEdgeFunction(callSite, callNode, retSite,
-                                                    retSiteNode);
-      CallToRetEdgeFunctionCache.insert(make_pair(key, ef));
-      return ef;
-    }
+  EdgeFunctionPtr getSummaryEdgeFunction(N callSite, D callNode, N retSite,
+                                         D retSiteNode) {
+    return SummaryEdgeFunctionCache.getOrCompute(
+        std::make_tuple(callSite, callNode, retSite, retSiteNode), [&] {
+          return problem.getSummaryEdgeFunction(callSite, callNode, retSite,
+                                                retSiteNode);
+        });
   }
 
-  std::shared_ptr<EdgeFunction<V>>
-  getSummaryEdgeFunction(N callSite, D callNode, N retSite, D retSiteNode) {
-    PAMM_FACTORY;
-    auto key = std::tie(callSite, callNode, retSite, retSiteNode);
-    if (SummaryEdgeFunctionCache.count(key)) {
-      INC_COUNTER("Summary-EF Cache Hit");
-      return SummaryEdgeFunctionCache.at(key);
-    } else {
-      INC_COUNTER("Summary-EF Construction");
-      auto ef = problem.getSummaryEdgeFunction(callSite, callNode, retSite,
-                                               retSiteNode);
-      SummaryEdgeFunctionCache.insert(make_pair(key, ef));
-      return ef;
-    }
+  /// Forgets all cached flow and edge functions, e.g. after the IR changed.
+  void clear() {
+    NormalFlowFunctionCache.clear();
+    CallFlowFunctionCache.clear();
+    ReturnFlowFunctionCache.clear();
+    CallToRetFlowFunctionCache.clear();
+    SummaryFlowFunctionCache.clear();
+    NormalEdgeFunctionCache.clear();
+    CallEdgeFunctionCache.clear();
+    ReturnEdgeFunctionCache.clear();
+    CallToRetEdgeFunctionCache.clear();
+    SummaryEdgeFunctionCache.clear();
+  }
+
+  /// Applies F to the name of each cache and the cache itself.
+  template <typename Fn> void forEachCache(Fn F) const {
+    F("normal flow function", NormalFlowFunctionCache);
+    F("call flow function", CallFlowFunctionCache);
+    F("return flow function", ReturnFlowFunctionCache);
+    F("call to return flow function", CallToRetFlowFunctionCache);
+    F("summary flow function", SummaryFlowFunctionCache);
+    F("normal edge function", NormalEdgeFunctionCache);
+    F("call edge function", CallEdgeFunctionCache);
+    F("return edge function", ReturnEdgeFunctionCache);
+    F("call to return edge function", CallToRetEdgeFunctionCache);
+    F("summary edge function", SummaryEdgeFunctionCache);
   }
 
-  void print() {
-#ifdef PERFORMANCE_EVA
-    PAMM_FACTORY;
+  /// Returns the total number of cache hits.
+  size_t getHits() const {
+    size_t Hits = 0;
+    forEachCache([&](const char *, const auto &C) { Hits += C.getHits(); });
+    return Hits;
+  }
+
+  /// Returns the total number of cache misses, i.e. constructed functions.
+  size_t getMisses() const {
+    size_t Misses = 0;
+    forEachCache([&](const char *, const auto &C) { Misses += C.getMisses(); });
+    return Misses;
+  }
+
+  /// Returns the total number of functions evicted from the caches.
+  size_t getEvictions() const {
+    size_t Evictions = 0;
+    forEachCache(
+        [&](const char *, const auto &C) { Evictions += C.getEvictions(); });
+    return Evictions;
+  }
+
+  void print() const {
     auto &lg = lg::get();
     BOOST_LOG_SEV(lg, INFO) << "Flow-Edge-Function Cache Statistics:";
-    BOOST_LOG_SEV(lg, INFO) << "normal flow function cache hits: "
-                            << GET_COUNTER("Normal-FF Cache Hit");
-    BOOST_LOG_SEV(lg, INFO) << "normal flow function constructions: "
-                            << GET_COUNTER("Normal-FF Construction");
-    BOOST_LOG_SEV(lg, INFO) << "call flow function cache hits: "
-                            << GET_COUNTER("Call-FF Cache Hit");
-    BOOST_LOG_SEV(lg, INFO) << "call flow function constructions: "
-                            << GET_COUNTER("Call-FF Construction");
-    BOOST_LOG_SEV(lg, INFO) << "return flow function cache hits: "
-                            << GET_COUNTER("Return-FF Cache Hit");
-    BOOST_LOG_SEV(lg, INFO) << "return flow function constructions: "
-                            << GET_COUNTER("Return-FF Construction");
-    BOOST_LOG_SEV(lg, INFO) << "call to return flow function cache hits: "
-                            << GET_COUNTER("CallToRet-FF Cache Hit");
-    BOOST_LOG_SEV(lg, INFO) << "call to return flow function constructions: "
-                            << GET_COUNTER("CallToRet-FF Construction");
-    // BOOST_LOG_SEV(lg, INFO) << "summary flow function cache hits: "
-    //                        << GET_COUNTER("Summary-FF Cache Hit");
-    // BOOST_LOG_SEV(lg, INFO) << "summary flow function constructions: "
-    //                         << GET_COUNTER("Summary-FF Construction");
-    BOOST_LOG_SEV(lg, INFO)
-        << "total flow function cache hits: "
-        << GET_SUM_COUNT({"Normal-FF Cache Hit", "Call-FF Cache Hit",
-                          "Return-FF Cache Hit", "CallToRet-FF Cache Hit"});
-    //"Summary-FF Cache Hit"});
-    BOOST_LOG_SEV(lg, INFO)
-        << "total flow function constructions: "
-        << GET_SUM_COUNT({"Normal-FF Construction", "Call-FF Construction",
-                          "Return-FF Construction",
-                          "CallToRet-FF Construction" /*,
-                "Summary-FF Construction"*/});
-    BOOST_LOG_SEV(lg, INFO) << " ";
-    BOOST_LOG_SEV(lg, INFO) << "normal edge function cache hits: "
-                            << GET_COUNTER("Normal-EF Cache Hit");
-    BOOST_LOG_SEV(lg, INFO) << "normal edge function constructions: "
-                            << GET_COUNTER("Normal-EF Construction");
-    BOOST_LOG_SEV(lg, INFO) << "call edge function cache hits: "
-                            << GET_COUNTER("Call-EF Cache Hit");
-    BOOST_LOG_SEV(lg, INFO) << "call edge function constructions: "
-                            << GET_COUNTER("Call-EF Construction");
-    BOOST_LOG_SEV(lg, INFO) << "return edge function cache hits: "
-                            << GET_COUNTER("Return-EF Cache Hit");
-    BOOST_LOG_SEV(lg, INFO) << "return edge function constructions: "
-                            << GET_COUNTER("Return-EF Construction");
-    BOOST_LOG_SEV(lg, INFO) << "call to return edge function cache hits: "
-                            << GET_COUNTER("CallToRet-EF Cache Hit");
-    BOOST_LOG_SEV(lg, INFO) << "call to return edge function constructions: "
-                            << GET_COUNTER("CallToRet-EF Construction");
-    BOOST_LOG_SEV(lg, INFO) << "summary edge function cache hits: "
-                            << GET_COUNTER("Summary-EF Cache Hit");
-    BOOST_LOG_SEV(lg, INFO) << "summary edge function constructions: "
-                            << GET_COUNTER("Summary-EF Construction");
-    BOOST_LOG_SEV(lg, INFO)
-        << "total edge function cache hits: "
-        << GET_SUM_COUNT({"Normal-EF Cache Hit", "Call-EF Cache Hit",
-                          "Return-EF Cache Hit", "CallToRet-EF Cache Hit",
-                          "Summary-EF Cache Hit"});
-    BOOST_LOG_SEV(lg, INFO)
-        << "total edge function constructions: "
-        << GET_SUM_COUNT({"Normal-EF Construction", "Call-EF Construction",
-                          "Return-EF Construction", "CallToRet-EF Construction",
-                          "Summary-EF Construction"});
+    forEachCache([&](const char *Name, const auto &C) {
+      BOOST_LOG_SEV(lg, INFO)
+          << Name << " cache hits: " << C.getHits()
+          << ", constructions: " << C.getMisses()
+          << ", evictions: " << C.getEvictions() << ", size: " << C.size();
+    });
+    BOOST_LOG_SEV(lg, INFO) << "total cache hits: " << getHits();
+    BOOST_LOG_SEV(lg, INFO) << "total constructions: " << getMisses();
+    BOOST_LOG_SEV(lg, INFO) << "total evictions: " << getEvictions();
     BOOST_LOG_SEV(lg, INFO) << "----------------------------------------------";
-#endif
   }
 };
 
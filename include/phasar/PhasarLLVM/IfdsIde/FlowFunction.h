@@ -17,14 +17,65 @@
 #ifndef ANALYSIS_IFDS_IDE_FLOWFUNCTION_H_
 #define ANALYSIS_IFDS_IDE_FLOWFUNCTION_H_
 
+#include <phasar/Config/ContainerConfiguration.h>
+#include <map>
 #include <set>
 
 namespace psr {
 
+/**
+ * Computes the facts that hold after a statement from a fact that holds
+ * before it. Flow functions implement computeTargets() and may override
+ * computeTargetSet() as well, or derive from FFSetFlowFunction, which
+ * implements computeTargets() by means of computeTargetSet().
+ */
 template <typename D> class FlowFunction {
 public:
   virtual ~FlowFunction() = default;
+
   virtual std::set<D> computeTargets(D source) = 0;
+
+  /**
+   * Returns the same facts as computeTargets(), but in a container that
+   * holds the few facts a flow function usually yields without allocating.
+   * The solvers call this one, hence, flow functions that are applied often
+   * should override it.
+   */
+  virtual FFSet<D> computeTargetSet(D source) {
+    std::set<D> targets = computeTargets(source);
+    return FFSet<D>(targets.begin(), targets.end());
+  }
+
+  /**
+   * Returns the targets of each of the given facts. The solver hands all
+   * facts that are pending at a node at once if configured to do so, see
+   * SolverConfiguration::batchFlowFunctions, such that flow functions that
+   * inspect the statement for every fact may do so once per batch instead.
+   * By default, computeTargetSet() is applied to each fact.
+   */
+  virtual std::map<D, FFSet<D>> computeTargetsBatch(const FFSet<D> &sources) {
+    std::map<D, FFSet<D>> targets;
+    for (D source : sources) {
+      targets.emplace(source, computeTargetSet(source));
+    }
+    return targets;
+  }
+};
+
+/**
+ * A flow function that computes its targets as an FFSet in the first place,
+ * computeTargets() only copies them into a std::set.
+ */
+template <typename D> class FFSetFlowFunction : public FlowFunction<D> {
+public:
+  virtual ~FFSetFlowFunction() = default;
+
+  std::set<D> computeTargets(D source) override {
+    FFSet<D> targets = computeTargetSet(source);
+    return std::set<D>(targets.begin(), targets.end());
+  }
+
+  FFSet<D> computeTargetSet(D source) override = 0;
 };
 
 } // namespace psr
@@ -17,42 +17,44 @@
 #ifndef ANALYSIS_IFDS_IDE_FLOW_FUNC_COMPOSE_H_
 #define ANALYSIS_IFDS_IDE_FLOW_FUNC_COMPOSE_H_
 
+#include <memory>
 #include <phasar/PhasarLLVM/IfdsIde/FlowFunction.h>
 #include <phasar/PhasarLLVM/IfdsIde/FlowFunctions/Identity.h>
-#include <set>
+#include <utility>
 #include <vector>
 
 namespace psr {
 
-template <typename D> class Compose : FlowFunction<D> {
+template <typename D> class Compose : public FFSetFlowFunction<D> {
 private:
-  const std::vector<FlowFunction<D>> funcs;
+  const std::vector<std::shared_ptr<FlowFunction<D>>> funcs;
 
 public:
-  Compose(const std::vector<FlowFunction<D>> &funcs) : funcs(funcs) {}
+  Compose(const std::vector<std::shared_ptr<FlowFunction<D>>> &funcs)
+      : funcs(funcs) {}
 
   virtual ~Compose() = default;
 
-  std::set<D> computeTargets(const D &source) override {
-    std::set<D> current(source);
-    for (const FlowFunction<D> &func : funcs) {
-      std::set<D> next;
+  FFSet<D> computeTargetSet(D source) override {
+    FFSet<D> current{source};
+    for (auto &func : funcs) {
+      FFSet<D> next;
       for (const D &d : current) {
-        std::set<D> target = func.computeTargets(d);
+        FFSet<D> target = func->computeTargetSet(d);
         next.insert(target.begin(), target.end());
       }
-      current = next;
+      current = std::move(next);
     }
     return current;
   }
 
   static std::shared_ptr<FlowFunction<D>>
-  compose(const std::vector<FlowFunction<D>> &funcs) {
-    std::vector<FlowFunction<D>> vec;
-    for (const FlowFunction<D> &func : funcs)
+  compose(const std::vector<std::shared_ptr<FlowFunction<D>>> &funcs) {
+    std::vector<std::shared_ptr<FlowFunction<D>>> vec;
+    for (auto &func : funcs)
       if (func != Identity<D>::getInstance())
-        vec.insert(func);
-    if (vec.size == 1)
+        vec.push_back(func);
+    if (vec.size() == 1)
       return vec[0];
     else if (vec.empty())
       return Identity<D>::getInstance();
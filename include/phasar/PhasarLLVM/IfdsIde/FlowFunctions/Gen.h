@@ -22,7 +22,7 @@
 
 namespace psr {
 
-template <typename D> class Gen : public FlowFunction<D> {
+template <typename D> class Gen : public FFSetFlowFunction<D> {
 private:
   D genValue;
   D zeroValue;
@@ -30,7 +30,7 @@ private:
 public:
   Gen(D genValue, D zeroValue) : genValue(genValue), zeroValue(zeroValue) {}
   virtual ~Gen() = default;
-  std::set<D> computeTargets(D source) override {
+  FFSet<D> computeTargetSet(D source) override {
     if (source == zeroValue)
       return {source, genValue};
     else
@@ -22,7 +22,7 @@
 
 namespace psr {
 
-template <typename D> class GenAll : public FlowFunction<D> {
+template <typename D> class GenAll : public FFSetFlowFunction<D> {
 private:
   std::set<D> genValues;
   D zeroValue;
@@ -31,10 +31,11 @@ public:
   GenAll(std::set<D> genValues, D zeroValue)
       : genValues(genValues), zeroValue(zeroValue) {}
   virtual ~GenAll() = default;
-  std::set<D> computeTargets(D source) override {
+  FFSet<D> computeTargetSet(D source) override {
     if (source == zeroValue) {
-      genValues.insert(source);
-      return genValues;
+      FFSet<D> targets{source};
+      targets.insert(genValues.begin(), genValues.end());
+      return targets;
     } else {
       return {source};
     }
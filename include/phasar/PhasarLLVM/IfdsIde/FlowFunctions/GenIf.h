@@ -19,7 +19,7 @@ namespace psr {
  * @brief Generates the given value if the given predicate evaluates to true.
  * @tparam D The type of data-flow facts to be generated.
  */
-template <typename D> class GenIf : public FlowFunction<D> {
+template <typename D> class GenIf : public FFSetFlowFunction<D> {
 private:
   D genValue;
   D zeroValue;
@@ -29,7 +29,7 @@ public:
   GenIf(D genValue, D zeroValue, std::function<bool(D)> Predicate)
       : genValue(genValue), zeroValue(zeroValue), Predicate(Predicate) {}
   virtual ~GenIf() = default;
-  std::set<D> computeTargets(D source) override {
+  FFSet<D> computeTargetSet(D source) override {
     if (Predicate(source))
       return {source, genValue};
     else
@@ -0,0 +1,47 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef ANALYSIS_IFDS_IDE_FLOW_FUNC_GENKILL_H_
+#define ANALYSIS_IFDS_IDE_FLOW_FUNC_GENKILL_H_
+
+#include <phasar/PhasarLLVM/IfdsIde/FlowFunction.h>
+#include <set>
+
+namespace psr {
+
+/**
+ * Generates all genValues from the zero value and kills all killValues. All
+ * other facts are passed through unchanged.
+ */
+template <typename D> class GenKill : public FFSetFlowFunction<D> {
+private:
+  std::set<D> genValues;
+  std::set<D> killValues;
+  D zeroValue;
+
+public:
+  GenKill(std::set<D> genValues, std::set<D> killValues, D zeroValue)
+      : genValues(genValues), killValues(killValues), zeroValue(zeroValue) {}
+  virtual ~GenKill() = default;
+  FFSet<D> computeTargetSet(D source) override {
+    if (source == zeroValue) {
+      FFSet<D> targets{source};
+      targets.insert(genValues.begin(), genValues.end());
+      return targets;
+    } else if (killValues.count(source)) {
+      return {};
+    } else {
+      return {source};
+    }
+  }
+};
+
+} // namespace psr
+
+#endif /* ANALYSIS_IFDS_IDE_FLOW_FUNC_GENKILL_H_ */
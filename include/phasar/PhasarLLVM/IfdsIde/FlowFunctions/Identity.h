@@ -23,7 +23,7 @@
 
 namespace psr {
 
-template <typename D> class Identity : public FlowFunction<D> {
+template <typename D> class Identity : public FFSetFlowFunction<D> {
 private:
   Identity() = default;
 
@@ -32,7 +32,7 @@ public:
   Identity(const Identity &i) = delete;
   Identity &operator=(const Identity &i) = delete;
   // simply return what the user provides
-  std::set<D> computeTargets(D source) override { return {source}; }
+  FFSet<D> computeTargetSet(D source) override { return {source}; }
   static std::shared_ptr<Identity> getInstance() {
     static std::shared_ptr<Identity> instance =
         std::shared_ptr<Identity>(new Identity);
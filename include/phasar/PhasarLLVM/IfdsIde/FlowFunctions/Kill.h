@@ -22,14 +22,14 @@
 
 namespace psr {
 
-template <typename D> class Kill : public FlowFunction<D> {
+template <typename D> class Kill : public FFSetFlowFunction<D> {
 private:
   D killValue;
 
 public:
   Kill(D killValue) : killValue(killValue) {}
   virtual ~Kill() = default;
-  std::set<D> computeTargets(D source) override {
+  FFSet<D> computeTargetSet(D source) override {
     if (source == killValue)
       return {};
     else
@@ -23,7 +23,7 @@
 
 namespace psr {
 
-template <typename D> class KillAll : public FlowFunction<D> {
+template <typename D> class KillAll : public FFSetFlowFunction<D> {
 private:
   KillAll() = default;
 
@@ -31,7 +31,7 @@ public:
   virtual ~KillAll() = default;
   KillAll(const KillAll &k) = delete;
   KillAll &operator=(const KillAll &k) = delete;
-  std::set<D> computeTargets(D source) override { return std::set<D>(); }
+  FFSet<D> computeTargetSet(D source) override { return {}; }
   static std::shared_ptr<KillAll<D>> getInstance() {
     static std::shared_ptr<KillAll> instance =
         std::shared_ptr<KillAll>(new KillAll);
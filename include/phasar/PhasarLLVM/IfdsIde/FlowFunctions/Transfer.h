@@ -22,7 +22,7 @@
 
 namespace psr {
 
-template <typename D> class Transfer : public FlowFunction<D> {
+template <typename D> class Transfer : public FFSetFlowFunction<D> {
 private:
   D toValue;
   D fromValue;
@@ -30,7 +30,7 @@ private:
 public:
   Transfer(D toValue, D fromValue) : toValue(toValue), fromValue(fromValue) {}
   virtual ~Transfer() = default;
-  std::set<D> computeTargets(D source) override {
+  FFSet<D> computeTargetSet(D source) override {
     if (source == fromValue)
       return {source, toValue};
     else if (source == toValue)
@@ -17,37 +17,37 @@
 #ifndef ANALYSIS_IFDS_IDE_FLOW_FUNC_UNION_H_
 #define ANALYSIS_IFDS_IDE_FLOW_FUNC_UNION_H_
 
+#include <memory>
 #include <phasar/PhasarLLVM/IfdsIde/FlowFunction.h>
-#include <set>
+#include <phasar/PhasarLLVM/IfdsIde/FlowFunctions/KillAll.h>
 #include <vector>
 
 namespace psr {
 
-template <typename D> class Union : public FlowFunction<D> {
+template <typename D> class Union : public FFSetFlowFunction<D> {
 private:
-  const std::vector<FlowFunction<D>> funcs;
+  const std::vector<std::shared_ptr<FlowFunction<D>>> funcs;
 
 public:
-  Union(const std::vector<FlowFunction<D>> &funcs) : funcs(funcs) {}
+  Union(const std::vector<std::shared_ptr<FlowFunction<D>>> &funcs)
+      : funcs(funcs) {}
   virtual ~Union() = default;
-  std::set<D> computeTargets(const D &source) override {
-    std::set<D> result;
-    for (const FlowFunction<D> &func : funcs) {
-      std::set<D> target = func.computeTarget(source);
+  FFSet<D> computeTargetSet(D source) override {
+    FFSet<D> result;
+    for (auto &func : funcs) {
+      FFSet<D> target = func->computeTargetSet(source);
       result.insert(target.begin(), target.end());
     }
     return result;
   }
-  static FlowFunction<D> setunion(const std::vector<FlowFunction<D>> &funcs) {
-    std::vector<FlowFunction<D>> vec;
-    for (const FlowFunction<D> &func : funcs)
-      if (func != Identity<D>::getInstance())
-        vec.add(func);
-    if (vec.size() == 1)
-      return vec[0];
-    else if (vec.empty())
-      return Identity<D>::getInstance();
-    return Union(vec);
+  // unlike in a composition, the identity is not neutral in a union
+  static std::shared_ptr<FlowFunction<D>>
+  setunion(const std::vector<std::shared_ptr<FlowFunction<D>>> &funcs) {
+    if (funcs.size() == 1)
+      return funcs[0];
+    else if (funcs.empty())
+      return KillAll<D>::getInstance();
+    return std::make_shared<Union>(funcs);
   }
 };
 } // namespace psr
@@ -22,6 +22,8 @@
 #include <phasar/PhasarLLVM/IfdsIde/EdgeFunctions.h>
 #include <phasar/PhasarLLVM/IfdsIde/IFDSTabulationProblem.h>
 #include <phasar/PhasarLLVM/IfdsIde/JoinLattice.h>
+#include <stdexcept>
+#include <string>
 #include <type_traits>
 namespace psr {
 
@@ -33,6 +35,20 @@ public:
   virtual ~IDETabulationProblem() = default;
   virtual std::shared_ptr<EdgeFunction<V>> allTopFunction() = 0;
   virtual std::string VtoString(V v) const = 0;
+  /**
+   * Returns a key that identifies the edge function f across runs of the
+   * analysis, and the edge function a key identifies. Like
+   * IFDSTabulationProblem::DtoKey(), required for persisting the solver's
+   * state.
+   */
+  virtual std::string EFtoKey(std::shared_ptr<EdgeFunction<V>> f) const {
+    throw std::runtime_error(
+        "The problem does not support persisting edge functions");
+  }
+  virtual std::shared_ptr<EdgeFunction<V>> KeytoEF(const std::string &key) {
+    throw std::runtime_error(
+        "The problem does not support persisting edge functions");
+  }
 };
 } // namespace psr
 
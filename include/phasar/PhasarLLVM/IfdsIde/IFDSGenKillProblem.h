@@ -0,0 +1,67 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef ANALYSIS_IFDS_IDE_IFDSGENKILLPROBLEM_H_
+#define ANALYSIS_IFDS_IDE_IFDSGENKILLPROBLEM_H_
+
+#include <memory>
+#include <phasar/PhasarLLVM/IfdsIde/DefaultIFDSTabulationProblem.h>
+#include <phasar/PhasarLLVM/IfdsIde/FlowFunctions/GenKill.h>
+#include <set>
+
+namespace psr {
+
+/**
+ * An IFDS problem whose intra-procedural flows are gen/kill functions, i.e.
+ * every normal and call-to-return flow generates a fixed set of facts from
+ * the zero value, kills a fixed set of facts and passes all other facts
+ * through. Call and return flows remain arbitrary flow functions, as they
+ * have to map actual to formal parameters and vice versa.
+ *
+ * Such problems can be solved by the BitVectorIFDSSolver, which applies the
+ * gen and kill sets to whole sets of facts at once. The normal and
+ * call-to-return flow functions are derived from the gen and kill sets, hence
+ * the problems can still be solved by the IFDSSolver as well.
+ */
+template <typename N, typename D, typename M, typename I>
+class IFDSGenKillProblem : public DefaultIFDSTabulationProblem<N, D, M, I> {
+public:
+  IFDSGenKillProblem(I icfg) : DefaultIFDSTabulationProblem<N, D, M, I>(icfg) {}
+
+  virtual ~IFDSGenKillProblem() = default;
+
+  virtual std::set<D> getNormalGen(N curr, N succ) = 0;
+
+  virtual std::set<D> getNormalKill(N curr, N succ) = 0;
+
+  virtual std::set<D> getCallToRetGen(N callSite, N retSite,
+                                      std::set<M> callees) = 0;
+
+  virtual std::set<D> getCallToRetKill(N callSite, N retSite,
+                                       std::set<M> callees) = 0;
+
+  std::shared_ptr<FlowFunction<D>> getNormalFlowFunction(N curr,
+                                                         N succ) override {
+    return std::make_shared<GenKill<D>>(getNormalGen(curr, succ),
+                                        getNormalKill(curr, succ),
+                                        this->zeroValue());
+  }
+
+  std::shared_ptr<FlowFunction<D>>
+  getCallToRetFlowFunction(N callSite, N retSite,
+                           std::set<M> callees) override {
+    return std::make_shared<GenKill<D>>(
+        getCallToRetGen(callSite, retSite, callees),
+        getCallToRetKill(callSite, retSite, callees), this->zeroValue());
+  }
+};
+
+} // namespace psr
+
+#endif /* ANALYSIS_IFDS_IDE_IFDSGENKILLPROBLEM_H_ */
@@ -0,0 +1,308 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef ANALYSIS_IFDS_IDE_IFDSPRODUCTPROBLEM_H_
+#define ANALYSIS_IFDS_IDE_IFDSPRODUCTPROBLEM_H_
+
+#include <climits>
+#include <functional>
+#include <map>
+#include <memory>
+#include <phasar/PhasarLLVM/IfdsIde/FlowFunction.h>
+#include <phasar/PhasarLLVM/IfdsIde/FlowFunctions/KillAll.h>
+#include <phasar/PhasarLLVM/IfdsIde/FlowFunctions/Union.h>
+#include <phasar/PhasarLLVM/IfdsIde/IFDSTabulationProblem.h>
+#include <phasar/PhasarLLVM/IfdsIde/ZeroedFlowFunction.h>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace psr {
+
+/**
+ * A data-flow fact of one of the problems that are solved together by an
+ * IFDSProductProblem, tagged with the index of its problem.
+ */
+template <typename D> struct TaggedFact {
+  unsigned Problem;
+  D Fact;
+
+  bool operator==(const TaggedFact &Other) const {
+    return Problem == Other.Problem && Fact == Other.Fact;
+  }
+  bool operator!=(const TaggedFact &Other) const { return !(*this == Other); }
+  bool operator<(const TaggedFact &Other) const {
+    return Problem != Other.Problem ? Problem < Other.Problem
+                                    : Fact < Other.Fact;
+  }
+};
+
+/**
+ * Applies the flow function of each of the problems of an
+ * IFDSProductProblem to the facts tagged with the problem's index.
+ */
+template <typename D>
+class ProductFlowFunction : public FFSetFlowFunction<TaggedFact<D>> {
+private:
+  std::vector<std::shared_ptr<FlowFunction<D>>> Functions;
+
+public:
+  explicit ProductFlowFunction(
+      std::vector<std::shared_ptr<FlowFunction<D>>> Functions)
+      : Functions(std::move(Functions)) {}
+
+  FFSet<TaggedFact<D>> computeTargetSet(TaggedFact<D> Source) override {
+    // the zero value of the product does not leave the seeds
+    if (Source.Problem >= Functions.size()) {
+      return {};
+    }
+    FFSet<TaggedFact<D>> Targets;
+    for (D Target : Functions[Source.Problem]->computeTargetSet(Source.Fact)) {
+      Targets.insert(TaggedFact<D>{Source.Problem, Target});
+    }
+    return Targets;
+  }
+
+  std::map<TaggedFact<D>, FFSet<TaggedFact<D>>>
+  computeTargetsBatch(const FFSet<TaggedFact<D>> &Sources) override {
+    // hand the facts of each problem to its flow function at once
+    std::vector<FFSet<D>> Facts(Functions.size());
+    std::map<TaggedFact<D>, FFSet<TaggedFact<D>>> Targets;
+    for (const TaggedFact<D> &Source : Sources) {
+      if (Source.Problem >= Functions.size()) {
+        Targets[Source];
+      } else {
+        Facts[Source.Problem].insert(Source.Fact);
+      }
+    }
+    for (unsigned K = 0; K < Functions.size(); ++K) {
+      if (Facts[K].empty()) {
+        continue;
+      }
+      for (auto &Entry : Functions[K]->computeTargetsBatch(Facts[K])) {
+        FFSet<TaggedFact<D>> &Tagged = Targets[TaggedFact<D>{K, Entry.first}];
+        for (D Target : Entry.second) {
+          Tagged.insert(TaggedFact<D>{K, Target});
+        }
+      }
+    }
+    return Targets;
+  }
+};
+
+/**
+ * Solves several IFDS problems on the same interprocedural CFG in a single
+ * pass of the solver, such that the supergraph is traversed and the flow
+ * functions are cached once for all of them. The facts of the product are
+ * the facts of the problems tagged with their problem's index, see
+ * TaggedFact, and factsOf() projects results back onto a problem.
+ *
+ * The problems keep their own zero values, such that every problem is
+ * solved exactly as on its own, including its seeds and the autoAddZero
+ * setting of its solver configuration. The product's own zero value only
+ * holds at the seeds. The solver configuration of the product is copied from
+ * the first problem and applies to the whole pass. Special summaries of the
+ * problems are applied alongside the call-to-return flow functions, as the
+ * solver can only skip a callee for all problems at once. The problems must
+ * outlive the product. As the results of all problems are held at once, a
+ * pass needs about as much memory as solving all of them separately.
+ */
+template <typename N, typename D, typename M, typename I>
+class IFDSProductProblem
+    : public IFDSTabulationProblem<N, TaggedFact<D>, M, I> {
+public:
+  using Fact = TaggedFact<D>;
+  using Problem = IFDSTabulationProblem<N, D, M, I>;
+  // the tag of the product's zero value
+  static constexpr unsigned ZeroTag = UINT_MAX;
+
+private:
+  std::vector<Problem *> Problems;
+  Fact Zero;
+
+  std::shared_ptr<FlowFunction<D>> addZero(unsigned K,
+                                           std::shared_ptr<FlowFunction<D>> F) {
+    if (Problems[K]->solver_config.autoAddZero) {
+      return std::make_shared<ZeroedFlowFunction<D>>(
+          F, Problems[K]->zeroValue());
+    }
+    return F;
+  }
+
+  template <typename Fn>
+  std::shared_ptr<FlowFunction<Fact>> makeProduct(Fn MakeFlowFunction) {
+    std::vector<std::shared_ptr<FlowFunction<D>>> Functions;
+    for (unsigned K = 0; K < Problems.size(); ++K) {
+      Functions.push_back(MakeFlowFunction(K));
+    }
+    return std::make_shared<ProductFlowFunction<D>>(std::move(Functions));
+  }
+
+public:
+  explicit IFDSProductProblem(std::vector<Problem *> Problems)
+      : Problems(std::move(Problems)) {
+    if (this->Problems.empty()) {
+      throw std::runtime_error("IFDSProductProblem: no problems given");
+    }
+    Zero = Fact{ZeroTag, this->Problems.front()->zeroValue()};
+    this->solver_config = this->Problems.front()->solver_config;
+    // the zero values of the problems are kept alive by their flow functions
+    this->solver_config.autoAddZero = false;
+  }
+
+  ~IFDSProductProblem() override = default;
+
+  /// Returns the number of problems that are solved together.
+  size_t size() const { return Problems.size(); }
+
+  /// Returns the facts of the K-th problem among the given product facts.
+  std::set<D> factsOf(unsigned K, const std::set<Fact> &Facts) const {
+    std::set<D> Result;
+    for (const Fact &F : Facts) {
+      if (F.Problem == K) {
+        Result.insert(F.Fact);
+      }
+    }
+    return Result;
+  }
+
+  std::shared_ptr<FlowFunction<Fact>> getNormalFlowFunction(N curr,
+                                                            N succ) override {
+    return makeProduct([&](unsigned K) {
+      return addZero(K, Problems[K]->getNormalFlowFunction(curr, succ));
+    });
+  }
+
+  std::shared_ptr<FlowFunction<Fact>> getCallFlowFunction(N callStmt,
+                                                          M destMthd) override {
+    return makeProduct([&](unsigned K) -> std::shared_ptr<FlowFunction<D>> {
+      // the facts of problems that summarize the callee do not enter it
+      if (Problems[K]->getSummaryFlowFunction(callStmt, destMthd)) {
+        return KillAll<D>::getInstance();
+      }
+      return addZero(K, Problems[K]->getCallFlowFunction(callStmt, destMthd));
+    });
+  }
+
+  std::shared_ptr<FlowFunction<Fact>>
+  getRetFlowFunction(N callSite, M calleeMthd, N exitStmt, N retSite) override {
+    return makeProduct([&](unsigned K) -> std::shared_ptr<FlowFunction<D>> {
+      if (Problems[K]->getSummaryFlowFunction(callSite, calleeMthd)) {
+        return KillAll<D>::getInstance();
+      }
+      return addZero(K, Problems[K]->getRetFlowFunction(callSite, calleeMthd,
+                                                        exitStmt, retSite));
+    });
+  }
+
+  std::shared_ptr<FlowFunction<Fact>>
+  getCallToRetFlowFunction(N callSite, N retSite,
+                           std::set<M> callees) override {
+    return makeProduct([&](unsigned K) {
+      std::vector<std::shared_ptr<FlowFunction<D>>> Functions{
+          addZero(K, Problems[K]->getCallToRetFlowFunction(callSite, retSite,
+                                                           callees))};
+      for (M Callee : callees) {
+        if (auto Summary =
+                Problems[K]->getSummaryFlowFunction(callSite, Callee)) {
+          Functions.push_back(Summary);
+        }
+      }
+      return Union<D>::setunion(Functions);
+    });
+  }
+
+  std::shared_ptr<FlowFunction<Fact>>
+  getSummaryFlowFunction(N callStmt, M destMthd) override {
+    return nullptr;
+  }
+
+  I interproceduralCFG() override {
+    return Problems.front()->interproceduralCFG();
+  }
+
+  std::map<N, std::set<Fact>> initialSeeds() override {
+    std::map<N, std::set<Fact>> Seeds;
+    for (unsigned K = 0; K < Problems.size(); ++K) {
+      for (auto &Seed : Problems[K]->initialSeeds()) {
+        for (const D &Value : Seed.second) {
+          Seeds[Seed.first].insert(Fact{K, Value});
+        }
+        // the solver computes the values of the seeds' facts from the
+        // product's zero value, which must hold at the seeds, hence
+        Seeds[Seed.first].insert(Zero);
+      }
+    }
+    return Seeds;
+  }
+
+  Fact zeroValue() override { return Zero; }
+
+  bool isZeroValue(Fact d) const override {
+    return d.Problem == ZeroTag || Problems[d.Problem]->isZeroValue(d.Fact);
+  }
+
+  bool mayAffect(N curr, Fact d) override {
+    return d.Problem == ZeroTag || Problems[d.Problem]->mayAffect(curr, d.Fact);
+  }
+
+  std::string DtoString(Fact d) const override {
+    if (d.Problem == ZeroTag) {
+      return "product zero value";
+    }
+    return "[" + std::to_string(d.Problem) + "] " +
+           Problems[d.Problem]->DtoString(d.Fact);
+  }
+
+  std::string NtoString(N n) const override {
+    return Problems.front()->NtoString(n);
+  }
+
+  std::string MtoString(M m) const override {
+    return Problems.front()->MtoString(m);
+  }
+
+  std::string DtoKey(Fact d) const override {
+    if (d.Problem == ZeroTag) {
+      return "zero";
+    }
+    return std::to_string(d.Problem) + ":" +
+           Problems[d.Problem]->DtoKey(d.Fact);
+  }
+
+  Fact KeytoD(const std::string &key) override {
+    if (key == "zero") {
+      return Zero;
+    }
+    size_t Colon = key.find(':');
+    if (Colon == std::string::npos) {
+      throw std::runtime_error("IFDSProductProblem: malformed key " + key);
+    }
+    unsigned K = std::stoul(key.substr(0, Colon));
+    if (K >= Problems.size()) {
+      throw std::runtime_error("IFDSProductProblem: malformed key " + key);
+    }
+    return Fact{K, Problems[K]->KeytoD(key.substr(Colon + 1))};
+  }
+};
+
+} // namespace psr
+
+namespace std {
+
+template <typename D> struct hash<psr::TaggedFact<D>> {
+  size_t operator()(const psr::TaggedFact<D> &F) const {
+    return hash<D>()(F.Fact) * 31 + F.Problem;
+  }
+};
+
+} // namespace std
+
+#endif /* ANALYSIS_IFDS_IDE_IFDSPRODUCTPROBLEM_H_ */
@@ -22,6 +22,7 @@
 #include <phasar/PhasarLLVM/IfdsIde/FlowFunctions.h>
 #include <phasar/PhasarLLVM/IfdsIde/SolverConfiguration.h>
 #include <set>
+#include <stdexcept>
 #include <string>
 #include <type_traits>
 
@@ -39,6 +40,26 @@ public:
   virtual std::string DtoString(D d) const = 0;
   virtual std::string NtoString(N n) const = 0;
   virtual std::string MtoString(M m) const = 0;
+  /**
+   * Returns false if the normal flow functions from curr to its successors
+   * map d to d alone and, for IDE problems, the normal edge functions of d
+   * are the identity. Sparse propagation, see
+   * SolverConfiguration::sparsePropagation, steps over statements that do
+   * not affect a fact. Must be conservative, i.e. return true when in doubt.
+   */
+  virtual bool mayAffect(N curr, D d) { return true; }
+  /**
+   * Returns a key that identifies d across runs of the analysis on the same
+   * program, and the fact a key identifies. The solver persists facts by
+   * their keys, see SolverConfiguration::checkpointFile. Problems that do
+   * not override both cannot be checkpointed.
+   */
+  virtual std::string DtoKey(D d) const {
+    throw std::runtime_error("The problem does not support persisting facts");
+  }
+  virtual D KeytoD(const std::string &key) {
+    throw std::runtime_error("The problem does not support persisting facts");
+  }
   void setSolverConfiguration(SolverConfiguration conf) {
     solver_config = conf;
   }
@@ -20,7 +20,7 @@ namespace psr {
  * actual parameter into formal parameter.
  * @brief Generates all valid formal parameter in the callee context.
  */
-class MapFactsToCallee : public FlowFunction<const llvm::Value *> {
+class MapFactsToCallee : public FFSetFlowFunction<const llvm::Value *> {
 private:
   std::vector<const llvm::Value *> actuals;
   std::vector<const llvm::Value *> formals;
@@ -42,9 +42,10 @@ public:
     }
   }
   virtual ~MapFactsToCallee() = default;
-  std::set<const llvm::Value *> computeTargets(const llvm::Value *source) {
+  FFSet<const llvm::Value *>
+  computeTargetSet(const llvm::Value *source) override {
     if (!isLLVMZeroValue(source)) {
-      std::set<const llvm::Value *> res;
+      FFSet<const llvm::Value *> res;
       // Map actual parameter into corresponding formal parameter.
       for (unsigned idx = 0; idx < actuals.size(); ++idx) {
         if (source == actuals[idx] && predicate(actuals[idx])) {
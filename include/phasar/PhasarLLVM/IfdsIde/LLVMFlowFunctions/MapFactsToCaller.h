@@ -23,7 +23,7 @@ namespace psr {
  * @brief Generates all valid actual parameters and the return value in the
  * caller context.
  */
-class MapFactsToCaller : public FlowFunction<const llvm::Value *> {
+class MapFactsToCaller : public FFSetFlowFunction<const llvm::Value *> {
 private:
   llvm::ImmutableCallSite callSite;
   const llvm::Function *calleeMthd;
@@ -53,9 +53,10 @@ public:
     }
   }
   virtual ~MapFactsToCaller() = default;
-  std::set<const llvm::Value *> computeTargets(const llvm::Value *source) {
+  FFSet<const llvm::Value *>
+  computeTargetSet(const llvm::Value *source) override {
     if (!isLLVMZeroValue(source)) {
-      std::set<const llvm::Value *> res;
+      FFSet<const llvm::Value *> res;
       // Map formal parameter into corresponding actual parameter.
       for (unsigned idx = 0; idx < formals.size(); ++idx) {
         if (source == formals[idx] && paramPredicate(formals[idx])) {
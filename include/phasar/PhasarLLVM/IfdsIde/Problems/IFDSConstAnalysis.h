@@ -11,7 +11,7 @@
 #define ANALYSIS_IFDS_IDE_PROBLEMS_IFDS_CONSTANALYSIS_H_
 
 #include <map>
-#include <phasar/PhasarLLVM/IfdsIde/DefaultIFDSTabulationProblem.h>
+#include <phasar/PhasarLLVM/IfdsIde/IFDSGenKillProblem.h>
 #include <set>
 #include <string>
 #include <vector>
@@ -34,11 +34,13 @@ class PointsToGraph;
  * A memory location is considered mutable after the second
  * write access. Thus, the first write access is allowed
  * to account for initialization.
+ * Mutable memory locations stay mutable, hence, the analysis is a gen/kill
+ * problem without kills and may be solved by the BitVectorIFDSSolver.
  * @brief Computes all possibly mutable memory locations.
  */
-class IFDSConstAnalysis : public DefaultIFDSTabulationProblem<
-                              const llvm::Instruction *, const llvm::Value *,
-                              const llvm::Function *, LLVMBasedICFG &> {
+class IFDSConstAnalysis
+    : public IFDSGenKillProblem<const llvm::Instruction *, const llvm::Value *,
+                                const llvm::Function *, LLVMBasedICFG &> {
 public:
   typedef const llvm::Value *d_t;
   typedef const llvm::Instruction *n_t;
@@ -78,8 +80,12 @@ public:
    * @param curr Currently analyzed program statement.
    * @param succ Successor statement.
    */
-  std::shared_ptr<FlowFunction<d_t>> getNormalFlowFunction(n_t curr,
-                                                           n_t succ) override;
+  std::set<d_t> getNormalGen(n_t curr, n_t succ) override;
+
+  /**
+   * @brief Nothing is killed, i.e. always returning the empty set.
+   */
+  std::set<d_t> getNormalKill(n_t curr, n_t succ) override;
 
   /**
    * The following llvm intrinsics
@@ -129,9 +135,14 @@ public:
    * @param callSite Call site.
    * @param retSite Return site.
    */
-  std::shared_ptr<FlowFunction<d_t>>
-  getCallToRetFlowFunction(n_t callSite, n_t retSite,
-                           std::set<m_t> callees) override;
+  std::set<d_t> getCallToRetGen(n_t callSite, n_t retSite,
+                                std::set<m_t> callees) override;
+
+  /**
+   * @brief Nothing is killed, i.e. always returning the empty set.
+   */
+  std::set<d_t> getCallToRetKill(n_t callSite, n_t retSite,
+                                 std::set<m_t> callees) override;
 
   /**
    * @brief Not used for this analysis, i.e. always returning nullptr.
@@ -11,6 +11,7 @@
 #define ANALYSIS_IFDS_IDE_PROBLEMS_IFDS_TAINTANALYSIS_H_
 
 #include <map>
+#include <mutex>
 #include <phasar/PhasarLLVM/IfdsIde/DefaultIFDSTabulationProblem.h>
 #include <set>
 #include <string>
@@ -89,6 +90,10 @@ public:
 
   std::map<n_t, std::set<d_t>> Leaks;
 
+  // guards Leaks, which the flow functions record into on the solver's
+  // threads
+  std::mutex LeaksMutex;
+
   static const std::map<std::string, SourceFunction> Sources;
 
   static const std::map<std::string, SinkFunction> Sinks;
@@ -117,12 +122,18 @@ public:
 
   std::map<n_t, std::set<d_t>> initialSeeds() override;
 
+  bool mayAffect(n_t curr, d_t d) override;
+
   d_t createZeroValue() override;
 
   bool isZeroValue(d_t d) const override;
 
   std::string DtoString(d_t d) const override;
 
+  std::string DtoKey(d_t d) const override;
+
+  d_t KeytoD(const std::string &key) override;
+
   std::string NtoString(n_t n) const override;
 
   std::string MtoString(m_t m) const override;
@@ -67,12 +67,18 @@ public:
 
   std::map<n_t, std::set<d_t>> initialSeeds() override;
 
+  bool mayAffect(n_t curr, d_t d) override;
+
   d_t createZeroValue() override;
 
   bool isZeroValue(d_t d) const override;
 
   std::string DtoString(d_t d) const override;
 
+  std::string DtoKey(d_t d) const override;
+
+  d_t KeytoD(const std::string &key) override;
+
   std::string NtoString(n_t n) const override;
 
   std::string MtoString(m_t m) const override;
@@ -0,0 +1,320 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef ANALYSIS_IFDS_IDE_SOLVER_BITVECTORIFDSSOLVER_H_
+#define ANALYSIS_IFDS_IDE_SOLVER_BITVECTORIFDSSOLVER_H_
+
+#include <deque>
+#include <map>
+#include <memory>
+#include <phasar/PhasarLLVM/IfdsIde/FlowFunction.h>
+#include <phasar/PhasarLLVM/IfdsIde/IFDSGenKillProblem.h>
+#include <phasar/PhasarLLVM/IfdsIde/ZeroedFlowFunction.h>
+#include <phasar/Utils/BitVectorSet.h>
+#include <phasar/Utils/Interner.h>
+#include <phasar/Utils/Logger.h>
+#include <set>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace psr {
+
+/**
+ * Solves IFDS problems whose intra-procedural flows are gen/kill functions.
+ *
+ * Instead of tabulating one path edge per pair of facts, the solver keeps the
+ * set of facts that is reachable at a node from a calling context <sP,d1> as a
+ * bit vector over the interned facts and pushes whole sets through the
+ * exploded super graph. Normal and call-to-return flows are applied as
+ * (X \ kill) | gen, where gen only applies if X contains the zero value. Call
+ * and return flow functions are applied to each newly reached fact.
+ *
+ * Only the facts that have been added since a node has been processed last
+ * are propagated, which is sound as all flows are distributive. The results
+ * equal those of the IFDSSolver, see BitVectorIFDSSolverTest, which compares
+ * both solvers on the IFDSConstAnalysis. Unbalanced returns, i.e.
+ * followReturnsPastSeeds, are not supported.
+ *
+ * @param <N> The type of nodes in the interprocedural control-flow graph.
+ * @param <D> The type of data-flow facts to be computed by the tabulation
+ * problem.
+ * @param <M> The type of objects used to represent methods.
+ * @param <I> The type of inter-procedural control-flow graph being used.
+ */
+template <typename N, typename D, typename M, typename I>
+class BitVectorIFDSSolver {
+public:
+  using IdType = typename Interner<D>::IdType;
+
+private:
+  struct GenKillMasks {
+    BitVectorSet Gen;
+    BitVectorSet Kill;
+  };
+
+  // all facts reachable from the start point sP holding the fact EntryFact
+  struct Context {
+    N StartPoint;
+    IdType EntryFact;
+    std::unordered_map<N, BitVectorSet> Facts;
+    // facts that have been reached but not yet propagated further
+    std::unordered_map<N, BitVectorSet> Pending;
+    // call sites and contexts of the callers that flow into this context
+    std::set<std::pair<N, size_t>> Callers;
+    std::set<N> ReachedExits;
+  };
+
+  IFDSGenKillProblem<N, D, M, I> &problem;
+  I icfg;
+  D zeroValue;
+  bool autoAddZero;
+  Interner<D> factIds;
+  IdType zeroId;
+  std::deque<Context> contexts;
+  std::map<std::pair<N, IdType>, size_t> contextIds;
+  std::unordered_map<M, std::vector<size_t>> contextsOfMethod;
+  std::deque<std::pair<size_t, N>> workList;
+  std::map<std::pair<N, N>, GenKillMasks> normalMasks;
+  std::map<std::pair<N, N>, GenKillMasks> callToRetMasks;
+
+  BitVectorSet toBitVector(const std::set<D> &Facts) {
+    BitVectorSet Bits;
+    for (const D &Fact : Facts) {
+      Bits.insert(factIds.getOrCreateId(Fact));
+    }
+    return Bits;
+  }
+
+  GenKillMasks makeMasks(const std::set<D> &Gen, const std::set<D> &Kill) {
+    GenKillMasks Masks;
+    Masks.Gen = toBitVector(Gen);
+    Masks.Kill = toBitVector(Kill);
+    // the zero value holds everywhere
+    Masks.Kill.erase(zeroId);
+    return Masks;
+  }
+
+  const GenKillMasks &getNormalMasks(N curr, N succ) {
+    auto Key = std::make_pair(curr, succ);
+    auto Search = normalMasks.find(Key);
+    if (Search == normalMasks.end()) {
+      Search = normalMasks
+                   .emplace(Key, makeMasks(problem.getNormalGen(curr, succ),
+                                           problem.getNormalKill(curr, succ)))
+                   .first;
+    }
+    return Search->second;
+  }
+
+  const GenKillMasks &getCallToRetMasks(N callSite, N retSite,
+                                        const std::set<M> &callees) {
+    auto Key = std::make_pair(callSite, retSite);
+    auto Search = callToRetMasks.find(Key);
+    if (Search == callToRetMasks.end()) {
+      Search =
+          callToRetMasks
+              .emplace(Key, makeMasks(
+                                problem.getCallToRetGen(callSite, retSite,
+                                                        callees),
+                                problem.getCallToRetKill(callSite, retSite,
+                                                         callees)))
+              .first;
+    }
+    return Search->second;
+  }
+
+  std::shared_ptr<FlowFunction<D>>
+  zeroed(std::shared_ptr<FlowFunction<D>> function) const {
+    if (autoAddZero) {
+      return std::make_shared<ZeroedFlowFunction<D>>(function, zeroValue);
+    }
+    return function;
+  }
+
+  BitVectorSet applyMasks(const GenKillMasks &Masks,
+                          const BitVectorSet &Facts) const {
+    BitVectorSet Result = Facts;
+    Result.subtract(Masks.Kill);
+    if (Facts.count(zeroId)) {
+      Result.unionWith(Masks.Gen);
+    }
+    return Result;
+  }
+
+  size_t getOrCreateContext(N sP, IdType EntryFact) {
+    auto Key = std::make_pair(sP, EntryFact);
+    auto Search = contextIds.find(Key);
+    if (Search != contextIds.end()) {
+      return Search->second;
+    }
+    size_t Ctx = contexts.size();
+    contexts.emplace_back();
+    contexts.back().StartPoint = sP;
+    contexts.back().EntryFact = EntryFact;
+    contextIds.emplace(Key, Ctx);
+    contextsOfMethod[icfg.getMethodOf(sP)].push_back(Ctx);
+    BitVectorSet Entry;
+    Entry.insert(EntryFact);
+    propagate(Ctx, sP, Entry);
+    return Ctx;
+  }
+
+  /// Adds the given facts to a node of a context and schedules the node if
+  /// any of the facts is new.
+  void propagate(size_t Ctx, N n, const BitVectorSet &Facts) {
+    Context &C = contexts[Ctx];
+    BitVectorSet &Pending = C.Pending[n];
+    bool WasIdle = Pending.empty();
+    if (C.Facts[n].unionWith(Facts, &Pending) && WasIdle) {
+      workList.emplace_back(Ctx, n);
+    }
+  }
+
+  void processCall(size_t Ctx, N n, const BitVectorSet &Facts) {
+    std::set<M> callees = icfg.getCalleesOfCallAt(n);
+    std::set<N> returnSiteNs = icfg.getReturnSitesOfCallAt(n);
+    for (M sCalledProcN : callees) {
+      std::shared_ptr<FlowFunction<D>> specialSum =
+          problem.getSummaryFlowFunction(n, sCalledProcN);
+      if (specialSum) {
+        BitVectorSet Targets;
+        Facts.forEach([&](IdType d2) {
+          for (const D &d3 : specialSum->computeTargetSet(factIds.get(d2))) {
+            Targets.insert(factIds.getOrCreateId(d3));
+          }
+        });
+        for (N returnSiteN : returnSiteNs) {
+          propagate(Ctx, returnSiteN, Targets);
+        }
+        continue;
+      }
+      std::shared_ptr<FlowFunction<D>> function =
+          zeroed(problem.getCallFlowFunction(n, sCalledProcN));
+      std::set<IdType> CalleeFacts;
+      Facts.forEach([&](IdType d2) {
+        for (const D &d3 : function->computeTargetSet(factIds.get(d2))) {
+          CalleeFacts.insert(factIds.getOrCreateId(d3));
+        }
+      });
+      for (N sP : icfg.getStartPointsOf(sCalledProcN)) {
+        for (IdType d3 : CalleeFacts) {
+          size_t CalleeCtx = getOrCreateContext(sP, d3);
+          if (contexts[CalleeCtx].Callers.emplace(n, Ctx).second) {
+            // a new incoming edge, return everything the callee context has
+            // computed so far
+            for (N eP : contexts[CalleeCtx].ReachedExits) {
+              returnFacts(CalleeCtx, eP, contexts[CalleeCtx].Facts[eP], n,
+                          Ctx);
+            }
+          }
+        }
+      }
+    }
+    for (N returnSiteN : returnSiteNs) {
+      propagate(Ctx, returnSiteN,
+                applyMasks(getCallToRetMasks(n, returnSiteN, callees), Facts));
+    }
+  }
+
+  void returnFacts(size_t CalleeCtx, N eP, const BitVectorSet &Facts, N c,
+                   size_t CallerCtx) {
+    M methodThatNeedsSummary = icfg.getMethodOf(eP);
+    for (N retSiteC : icfg.getReturnSitesOfCallAt(c)) {
+      std::shared_ptr<FlowFunction<D>> retFunction = zeroed(
+          problem.getRetFlowFunction(c, methodThatNeedsSummary, eP, retSiteC));
+      BitVectorSet Targets;
+      Facts.forEach([&](IdType d4) {
+        for (const D &d5 : retFunction->computeTargetSet(factIds.get(d4))) {
+          Targets.insert(factIds.getOrCreateId(d5));
+        }
+      });
+      propagate(CallerCtx, retSiteC, Targets);
+    }
+  }
+
+  void processExit(size_t Ctx, N n, const BitVectorSet &Facts) {
+    contexts[Ctx].ReachedExits.insert(n);
+    // copy, returning may register new callers of recursive methods
+    std::set<std::pair<N, size_t>> Callers = contexts[Ctx].Callers;
+    for (auto &Caller : Callers) {
+      returnFacts(Ctx, n, Facts, Caller.first, Caller.second);
+    }
+  }
+
+  void processNormalFlow(size_t Ctx, N n, const BitVectorSet &Facts) {
+    for (N m : icfg.getSuccsOf(n)) {
+      propagate(Ctx, m, applyMasks(getNormalMasks(n, m), Facts));
+    }
+  }
+
+  void process(size_t Ctx, N n) {
+    BitVectorSet Facts;
+    std::swap(Facts, contexts[Ctx].Pending[n]);
+    if (icfg.isCallStmt(n)) {
+      processCall(Ctx, n, Facts);
+    } else {
+      if (icfg.isExitStmt(n)) {
+        processExit(Ctx, n, Facts);
+      }
+      if (!icfg.getSuccsOf(n).empty()) {
+        processNormalFlow(Ctx, n, Facts);
+      }
+    }
+  }
+
+public:
+  BitVectorIFDSSolver(IFDSGenKillProblem<N, D, M, I> &problem)
+      : problem(problem), icfg(problem.interproceduralCFG()),
+        zeroValue(problem.zeroValue()),
+        autoAddZero(problem.solver_config.autoAddZero),
+        zeroId(factIds.getOrCreateId(zeroValue)) {}
+
+  virtual ~BitVectorIFDSSolver() = default;
+
+  void solve() {
+    auto &lg = lg::get();
+    BOOST_LOG_SEV(lg, INFO) << "Bit-vector IFDS solver is solving the "
+                               "analysis problem";
+    for (const auto &seed : problem.initialSeeds()) {
+      N startPoint = seed.first;
+      size_t Ctx = getOrCreateContext(startPoint, zeroId);
+      propagate(Ctx, startPoint, toBitVector(seed.second));
+    }
+    while (!workList.empty()) {
+      std::pair<size_t, N> Item = workList.front();
+      workList.pop_front();
+      process(Item.first, Item.second);
+    }
+    BOOST_LOG_SEV(lg, INFO) << "Bit-vector IFDS solver computed "
+                            << contexts.size() << " contexts over "
+                            << factIds.size() << " facts";
+  }
+
+  /// Returns the facts that hold at the given statement.
+  std::set<D> ifdsResultsAt(N stmt) {
+    BitVectorSet Facts;
+    auto Search = contextsOfMethod.find(icfg.getMethodOf(stmt));
+    if (Search != contextsOfMethod.end()) {
+      for (size_t Ctx : Search->second) {
+        auto FactsAtStmt = contexts[Ctx].Facts.find(stmt);
+        if (FactsAtStmt != contexts[Ctx].Facts.end()) {
+          Facts.unionWith(FactsAtStmt->second);
+        }
+      }
+    }
+    std::set<D> Result;
+    Facts.forEach([&](IdType Id) { Result.insert(factIds.get(Id)); });
+    return Result;
+  }
+};
+
+} // namespace psr
+
+#endif /* ANALYSIS_IFDS_IDE_SOLVER_BITVECTORIFDSSOLVER_H_ */
@@ -17,12 +17,20 @@
 #ifndef ANALYSIS_IFDS_IDE_SOLVER_IDESOLVER_H_
 #define ANALYSIS_IFDS_IDE_SOLVER_IDESOLVER_H_
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <boost/algorithm/string/trim.hpp>
 #include <chrono>
+#include <cstdio>
+#include <deque>
+#include <fstream>
 #include <json.hpp>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <phasar/PhasarLLVM/IfdsIde/EdgeFunction.h>
+#include <phasar/PhasarLLVM/IfdsIde/EdgeFunctionFactory.h>
 #include <phasar/PhasarLLVM/IfdsIde/EdgeFunctions.h>
 #include <phasar/PhasarLLVM/IfdsIde/EdgeFunctions/EdgeIdentity.h>
 #include <phasar/PhasarLLVM/IfdsIde/FlowEdgeFunctionCache.h>
@@ -33,15 +41,28 @@
 #include <phasar/PhasarLLVM/IfdsIde/Solver/JoinHandlingNode.h>
 #include <phasar/PhasarLLVM/IfdsIde/Solver/JumpFunctions.h>
 #include <phasar/PhasarLLVM/IfdsIde/Solver/LinkedNode.h>
+#include <phasar/PhasarLLVM/IfdsIde/Solver/ParallelPathEdgeWorkList.h>
 #include <phasar/PhasarLLVM/IfdsIde/Solver/PathEdge.h>
+#include <phasar/PhasarLLVM/IfdsIde/Solver/PathEdgeWorkList.h>
+#include <phasar/PhasarLLVM/IfdsIde/Solver/SharedEndSummaries.h>
 #include <phasar/PhasarLLVM/IfdsIde/ZeroedFlowFunction.h>
+#include <phasar/Utils/BinaryIO.h>
 #include <phasar/Utils/LLVMShorthands.h>
+#include <phasar/Utils/Interner.h>
 #include <phasar/Utils/Logger.h>
+#include <phasar/Utils/MappedLog.h>
+#include <phasar/Utils/PAMM.h>
 #include <phasar/Utils/Table.h>
 #include <set>
+#include <stdexcept>
 #include <string>
+#include <thread>
 #include <type_traits>
+#include <unistd.h>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
 using json = nlohmann::json;
 
@@ -66,22 +87,55 @@ class IFDSToIDETabulationProblem;
 template <typename N, typename D, typename M, typename V, typename I>
 class IDESolver {
 public:
+  using SharedSummaries = SharedEndSummaries<N, D, V>;
+
   IDESolver(IDETabulationProblem<N, D, M, V, I> &tabulationProblem)
       : ideTabulationProblem(tabulationProblem),
-        cachedFlowEdgeFunctions(tabulationProblem),
+        cachedFlowEdgeFunctions(
+            tabulationProblem,
+            shardsFor(threadsToUse(tabulationProblem.solver_config.numThreads))),
         recordEdges(tabulationProblem.solver_config.recordEdges),
         zeroValue(tabulationProblem.zeroValue()),
         icfg(tabulationProblem.interproceduralCFG()),
         computevalues(tabulationProblem.solver_config.computeValues),
+        computeValuesLazily(
+            tabulationProblem.solver_config.computeValuesLazily),
+        blockwisePropagation(
+            tabulationProblem.solver_config.blockwisePropagation),
+        sparsePropagation(tabulationProblem.solver_config.sparsePropagation),
+        batchFlowFunctions(tabulationProblem.solver_config.batchFlowFunctions),
         autoAddZero(tabulationProblem.solver_config.autoAddZero),
         followReturnPastSeeds(
             tabulationProblem.solver_config.followReturnsPastSeeds),
         computePersistedSummaries(
             tabulationProblem.solver_config.computePersistedSummaries),
-        allTop(tabulationProblem.allTopFunction()),
+        numThreads(threadsToUse(tabulationProblem.solver_config.numThreads)),
+        jumpFunctionGCInterval(
+            tabulationProblem.solver_config.jumpFunctionGCInterval),
+        maxInMemoryJumpFunctions(
+            tabulationProblem.solver_config.maxInMemoryJumpFunctions),
+        nodeIds(std::make_shared<Interner<N>>(numShards())),
+        factIds(std::make_shared<Interner<D>>(numShards())),
+        edgeFunctionFactory(
+            tabulationProblem.solver_config.edgeFunctionCacheSize,
+            numShards()),
+        allTop(edgeFunctionFactory.intern(tabulationProblem.allTopFunction())),
         jumpFn(std::make_shared<JumpFunctions<N, D, M, V, I>>(
-            allTop, ideTabulationProblem)),
+            allTop, ideTabulationProblem, numShards(), nodeIds, factIds,
+            tabulationProblem.solver_config.spillDirectory)),
+        pathEdgeWorkList(tabulationProblem.solver_config.workListStrategy),
+        propagateMutexes(numShards()),
         initialSeeds(tabulationProblem.initialSeeds()) {
+    if (numThreads < tabulationProblem.solver_config.numThreads) {
+      auto &lg = lg::get();
+      BOOST_LOG_SEV(lg, WARNING)
+          << "Processing path edges on one thread, as PAMM is enabled";
+    }
+    if (numThreads > 1) {
+      parallelPathEdgeWorkList =
+          std::make_unique<ParallelPathEdgeWorkList<N, D>>(
+              numThreads, tabulationProblem.solver_config.workListStrategy);
+    }
     std::cout << "called IDESolver::IDESolver() ctor with IDEProblem"
               << std::endl;
   }
@@ -100,7 +154,7 @@ public:
   json getAsJson() {
     const static std::string DataFlowID = "DataFlow";
     json J;
-    auto results = this->valtab.cellSet();
+    auto results = this->valtabCellSet();
     if (results.empty()) {
       J[DataFlowID] = "EMPTY";
     } else {
@@ -232,13 +286,102 @@ public:
     // We start our analysis and construct exploded supergraph
     BOOST_LOG_SEV(lg, INFO)
         << "Submit initial seeds, construct exploded super graph";
+    BOOST_LOG_SEV(lg, INFO) << "Path edge work list strategy: "
+                            << pathEdgeWorkList.getStrategy();
+    if (parallelPathEdgeWorkList) {
+      BOOST_LOG_SEV(lg, INFO)
+          << "Process path edges using " << numThreads << " threads";
+    }
+    if (jumpFunctionGCInterval > 0 &&
+        (computevalues || followReturnPastSeeds || parallelPathEdgeWorkList)) {
+      BOOST_LOG_SEV(lg, WARNING)
+          << "Jump functions are not collected, as values are computed, "
+             "returns are followed past seeds or path edges are processed "
+             "by multiple threads";
+      jumpFunctionGCInterval = 0;
+    }
+    if (pathEdgeWorkList.isPrioritized() && parallelPathEdgeWorkList) {
+      BOOST_LOG_SEV(lg, WARNING) << "Path edges are not prioritized, as they "
+                                    "are processed by multiple threads";
+    }
+    if (maxInMemoryJumpFunctions > 0 && parallelPathEdgeWorkList) {
+      BOOST_LOG_SEV(lg, WARNING) << "Jump functions are not spilled, as path "
+                                    "edges are processed by multiple threads";
+      maxInMemoryJumpFunctions = 0;
+    }
+    auto &config = ideTabulationProblem.solver_config;
+    if (!config.checkpointFile.empty() && !checkpointRestored) {
+      checkpointRestored = true;
+      std::ifstream checkpoint(config.checkpointFile);
+      if (checkpoint.good()) {
+        BOOST_LOG_SEV(lg, INFO)
+            << "Resume from checkpoint " << config.checkpointFile;
+        loadCheckpoint(config.checkpointFile);
+      }
+    }
+    if (computePersistedSummaries && !config.persistedSummariesFile.empty() &&
+        !persistedSummariesImported) {
+      persistedSummariesImported = true;
+      std::ifstream summaries(config.persistedSummariesFile);
+      if (summaries.good()) {
+        // the file is a cache, an unreadable one is overwritten after solving
+        try {
+          importSummaries(config.persistedSummariesFile);
+        } catch (std::exception &e) {
+          BOOST_LOG_SEV(lg, WARNING)
+              << "Ignored persisted summaries: " << e.what();
+        }
+      }
+    }
+    status = SolverStatus::Unsolved;
+    solveStart = std::chrono::steady_clock::now();
+    numPathEdgesInSolve = 0;
+    nextResourceCheck = 0;
+    solveActive = true;
     submitInitalSeeds();
+    solveActive = false;
+    if (status == SolverStatus::Unsolved) {
+      status = SolverStatus::Solved;
+      if (computePersistedSummaries && !config.persistedSummariesFile.empty()) {
+        try {
+          exportSummaries(config.persistedSummariesFile);
+        } catch (std::runtime_error &e) {
+          BOOST_LOG_SEV(lg, WARNING)
+              << "Could not export summaries: " << e.what();
+        }
+      }
+      if (sharedEndSummaries) {
+        size_t numPublished = publishEndSummaries(nullptr);
+        BOOST_LOG_SEV(lg, INFO)
+            << "Published " << numPublished << " end summaries";
+      }
+      // a later run must not resume from the state of a finished one
+      if (!config.checkpointFile.empty()) {
+        std::remove(config.checkpointFile.c_str());
+      }
+    } else {
+      BOOST_LOG_SEV(lg, WARNING)
+          << "Solving has been interrupted (" << status.load()
+          << "), the results are incomplete";
+      if (!config.checkpointFile.empty()) {
+        trySaveCheckpoint(config.checkpointFile);
+      }
+    }
     STOP_TIMER("DFA Phase I");
+    if (!parallelPathEdgeWorkList) {
+      BOOST_LOG_SEV(lg, INFO) << "Max. number of pending path edges: "
+                              << pathEdgeWorkList.maxSize();
+    }
+    BOOST_LOG_SEV(lg, INFO) << "Number of re-joined jump functions: "
+                            << numJumpFunctionRejoins;
     if (computevalues) {
       START_TIMER("DFA Phase II");
       // Computing the final values for the edge functions
       BOOST_LOG_SEV(lg, INFO)
           << "Compute the final values according to the edge functions";
+      // the values of an interrupted run are computed anew
+      valtab.clear();
+      pendingValueNodes.clear();
       computeValues();
       STOP_TIMER("DFA Phase II");
     }
@@ -267,11 +410,659 @@ public:
 #endif
   }
 
+  /**
+   * Invalidates the results the solver has computed for the given methods
+   * and their transitive callers, such that solveIncrementally() recomputes
+   * them. The results of all other methods, in particular the end summaries
+   * of their calling contexts, are kept and reused.
+   *
+   * Must be called before the IR of the changed methods is modified, while
+   * the interprocedural CFG still describes the analyzed program. Data-flow
+   * facts of the unchanged methods must not refer to values of the changed
+   * ones. If returns are followed past seeds, all results are invalidated,
+   * as unbalanced returns propagate facts from callees into their callers.
+   * If the program changes between processes, see loadIncrementally().
+   */
+  void invalidate(const std::set<M> &changedMethods) {
+    auto &lg = lg::get();
+    querySeedsSubmitted = false;
+    queryExplorationDone = false;
+    valtab.clear();
+    pendingValueNodes.clear();
+    // the control-flow and call graphs of the changed methods may change
+    reversePostOrderIndex.clear();
+    sccRank.clear();
+    cachedFlowEdgeFunctions.clear();
+    // the hashes of the changed methods and of their transitive callers change
+    for (M m : changedMethods) {
+      methodHashes.erase(m);
+    }
+    summaryHashes.clear();
+    if (followReturnPastSeeds) {
+      importedSummaries.clear();
+      jumpFn->clear();
+      endsummarytab.clear();
+      coldEndSummaries.clear();
+      coldEndSummaryLog.reset();
+      incomingtab.clear();
+      unbalancedRetSites.clear();
+      computedIntraPathEdges.clear();
+      computedInterPathEdges.clear();
+      BOOST_LOG_SEV(lg, INFO) << "Invalidated all results";
+      return;
+    }
+    std::unordered_set<M> affected(changedMethods.begin(),
+                                   changedMethods.end());
+    std::vector<M> callees(changedMethods.begin(), changedMethods.end());
+    while (!callees.empty()) {
+      M callee = callees.back();
+      callees.pop_back();
+      for (N callSite : icfg.getCallersOf(callee)) {
+        M caller = icfg.getMethodOf(callSite);
+        if (affected.insert(caller).second) {
+          callees.push_back(caller);
+        }
+      }
+    }
+    std::unordered_set<IdType> affectedNodes;
+    for (M m : affected) {
+      for (N n : icfg.getAllInstructionsOf(m)) {
+        jumpFn->removeFunctionsAt(n);
+        unbalancedRetSites.erase(n);
+        for (auto *recorded :
+             {&computedIntraPathEdges, &computedInterPathEdges}) {
+          recorded->remove(n);
+          for (auto &entry : recorded->column(n)) {
+            recorded->remove(entry.first, n);
+          }
+        }
+        IdType id = nodeIds->getId(n);
+        if (id != Interner<N>::InvalidId) {
+          affectedNodes.insert(id);
+        }
+      }
+    }
+    // the end summaries of the calling contexts of the affected methods
+    for (auto it = endsummarytab.begin(); it != endsummarytab.end();) {
+      if (affectedNodes.count(unpackFirstId(it->first))) {
+        it = endsummarytab.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    for (auto it = coldEndSummaries.begin(); it != coldEndSummaries.end();) {
+      if (affectedNodes.count(unpackFirstId(it->first))) {
+        it = coldEndSummaries.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    for (auto it = importedSummaries.begin(); it != importedSummaries.end();) {
+      if (affectedNodes.count(unpackFirstId(it->first))) {
+        it = importedSummaries.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    // the incoming edges of calls from within the affected methods; they are
+    // registered again when the calls are processed again
+    for (auto it = incomingtab.begin(); it != incomingtab.end();) {
+      for (auto callSite = it->second.begin();
+           callSite != it->second.end();) {
+        if (affectedNodes.count(callSite->first)) {
+          callSite = it->second.erase(callSite);
+        } else {
+          ++callSite;
+        }
+      }
+      if (it->second.empty()) {
+        it = incomingtab.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    BOOST_LOG_SEV(lg, INFO) << "Invalidated the results of " << affected.size()
+                            << " methods";
+  }
+
+  /**
+   * Recomputes the results that have been invalidated by invalidate(). Must
+   * be called after the IR has been modified and the interprocedural CFG has
+   * been updated accordingly. Only the path edges of the invalidated methods
+   * are propagated again, the values of Phase II are recomputed for the whole
+   * program.
+   */
+  void solveIncrementally() {
+    auto &lg = lg::get();
+    BOOST_LOG_SEV(lg, INFO) << "IDE solver is re-solving the invalidated "
+                               "results";
+    // the seeds of unchanged methods are already contained in the jump
+    // functions and are not propagated any further
+    initialSeeds = ideTabulationProblem.initialSeeds();
+    submitInitalSeeds();
+    if (computevalues) {
+      computeValues();
+    }
+    BOOST_LOG_SEV(lg, INFO) << "Problem re-solved";
+  }
+
+  /**
+   * Returns how the last call to solve() has ended. If it has been
+   * interrupted, the results only contain the facts that have been reached
+   * so far, and solve() may be called again to resume.
+   */
+  SolverStatus getStatus() const { return status; }
+
+  /**
+   * Saves the solver's state, i.e. its jump functions, end summaries,
+   * incoming edges and pending path edges, such that a solver of another
+   * process may resume from it by loadCheckpoint(), or reuse the results of
+   * a finished run for a changed program by loadIncrementally(). Nodes are
+   * saved by their method's name, the hash of its IR and their position in
+   * it, facts and edge functions by the keys of the problem, see
+   * IFDSTabulationProblem::DtoKey(). The file is replaced atomically. Throws
+   * a std::runtime_error and leaves the file as it is if a fact or edge
+   * function has no key or the file cannot be written. Must not be called
+   * while path edges are processed.
+   */
+  void saveCheckpoint(const std::string &path) {
+    auto &lg = lg::get();
+    // the records are collected first, as they refer to the tables
+    std::unordered_map<M, uint64_t> methodIndex;
+    std::vector<M> methods;
+    std::unordered_map<M, std::unordered_map<N, uint64_t>> positions;
+    std::unordered_map<N, uint64_t> nodeIndex;
+    std::vector<std::pair<uint64_t, uint64_t>> nodes;
+    std::unordered_map<D, uint64_t> factIndex;
+    std::vector<D> facts;
+    std::map<EdgeFunctionRef<V>, uint64_t> functionIndex;
+    std::vector<EdgeFunctionRef<V>> functions;
+    auto node = [&](N n) {
+      auto inserted = nodeIndex.emplace(n, nodes.size());
+      if (inserted.second) {
+        M m = icfg.getMethodOf(n);
+        auto method = methodIndex.emplace(m, methods.size());
+        if (method.second) {
+          methods.push_back(m);
+          auto &position = positions[m];
+          for (N inst : icfg.getAllInstructionsOf(m)) {
+            position.emplace(inst, position.size());
+          }
+        }
+        nodes.emplace_back(method.first->second, positions[m].at(n));
+      }
+      return inserted.first->second;
+    };
+    auto fact = [&](D d) {
+      auto inserted = factIndex.emplace(d, facts.size());
+      if (inserted.second) {
+        facts.push_back(d);
+      }
+      return inserted.first->second;
+    };
+    auto function = [&](EdgeFunctionRef<V> f) {
+      auto inserted = functionIndex.emplace(f, functions.size());
+      if (inserted.second) {
+        functions.push_back(f);
+      }
+      return inserted.first->second;
+    };
+    std::vector<std::array<uint64_t, 4>> jumpFunctions;
+    for (N target : jumpFn->getTargets()) {
+      uint64_t targetIndex = node(target);
+      for (auto entry : jumpFn->lookupByTarget(target)) {
+        jumpFunctions.push_back({fact(entry.sourceVal), targetIndex,
+                                 fact(entry.targetVal),
+                                 function(entry.function)});
+      }
+    }
+    std::vector<std::array<uint64_t, 5>> endSummaries;
+    std::vector<std::array<uint64_t, 4>> incomingEdges;
+    {
+      std::lock_guard<std::mutex> lock(summaryMutex);
+      auto context = [&](uint64_t packed) {
+        return std::make_pair(node(nodeIds->get(unpackFirstId(packed))),
+                              fact(factIds->get(unpackSecondId(packed))));
+      };
+      forEachEndSummary(
+          [&](uint64_t start, uint64_t exit, EdgeFunctionRef<V> f) {
+            auto sP = context(start);
+            auto eP = context(exit);
+            endSummaries.push_back(
+                {sP.first, sP.second, eP.first, eP.second, function(f)});
+          });
+      for (auto &start : incomingtab) {
+        auto sP = context(start.first);
+        for (auto &callSite : start.second) {
+          uint64_t callSiteIndex = node(nodeIds->get(callSite.first));
+          for (IdType d2 : callSite.second) {
+            incomingEdges.push_back(
+                {sP.first, sP.second, callSiteIndex, fact(factIds->get(d2))});
+          }
+        }
+      }
+    }
+    std::vector<std::array<uint64_t, 3>> pendingEdges;
+    auto addPendingEdge = [&](PathEdge<N, D> edge) {
+      pendingEdges.push_back({fact(edge.factAtSource()),
+                              node(edge.getTarget()),
+                              fact(edge.factAtTarget())});
+    };
+    if (parallelPathEdgeWorkList) {
+      parallelPathEdgeWorkList->forEach(addPendingEdge);
+    } else {
+      pathEdgeWorkList.forEach(addPendingEdge);
+    }
+    std::vector<uint64_t> unbalancedReturns;
+    for (N n : unbalancedRetSites) {
+      unbalancedReturns.push_back(node(n));
+    }
+    // the keys are computed before the file is created, as the problem
+    // throws for facts and edge functions that have none
+    std::vector<std::string> factKeys;
+    for (D d : facts) {
+      factKeys.push_back(ideTabulationProblem.DtoKey(d));
+    }
+    std::vector<std::string> functionKeys;
+    for (EdgeFunctionRef<V> f : functions) {
+      functionKeys.push_back(ideTabulationProblem.EFtoKey(f.ptr()));
+    }
+    std::string tmpPath = path + ".tmp";
+    {
+      std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+      BinaryWriter out(file);
+      out.writeString(CheckpointMagic);
+      out.writeInt(CheckpointVersion);
+      out.writeInt(methods.size());
+      for (M m : methods) {
+        out.writeString(icfg.getMethodName(m));
+        out.writeInt(methodHash(m));
+      }
+      out.writeInt(nodes.size());
+      for (auto &n : nodes) {
+        out.writeInt(n.first);
+        out.writeInt(n.second);
+      }
+      out.writeInt(factKeys.size());
+      for (auto &key : factKeys) {
+        out.writeString(key);
+      }
+      out.writeInt(functionKeys.size());
+      for (auto &key : functionKeys) {
+        out.writeString(key);
+      }
+      auto writeRecords = [&out](const auto &records) {
+        out.writeInt(records.size());
+        for (auto &record : records) {
+          for (uint64_t field : record) {
+            out.writeInt(field);
+          }
+        }
+      };
+      writeRecords(jumpFunctions);
+      writeRecords(endSummaries);
+      writeRecords(incomingEdges);
+      writeRecords(pendingEdges);
+      out.writeInt(unbalancedReturns.size());
+      for (uint64_t n : unbalancedReturns) {
+        out.writeInt(n);
+      }
+      file.flush();
+      if (!out.good()) {
+        file.close();
+        std::remove(tmpPath.c_str());
+        throw std::runtime_error("Could not write checkpoint " + tmpPath);
+      }
+    }
+    if (std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+      std::remove(tmpPath.c_str());
+      throw std::runtime_error("Could not replace checkpoint " + path);
+    }
+    BOOST_LOG_SEV(lg, INFO) << "Saved checkpoint " << path << " with "
+                            << jumpFunctions.size() << " jump functions and "
+                            << pendingEdges.size() << " pending path edges";
+  }
+
+  /**
+   * Adds the state saved by saveCheckpoint() to the solver's state, such that
+   * solve() resumes where the saving solver has been interrupted. The methods
+   * the checkpoint refers to must not have changed in between, which is
+   * checked by the hashes of their IR. Throws a std::runtime_error if the
+   * checkpoint cannot be read or does not match the program.
+   */
+  void loadCheckpoint(const std::string &path) { readCheckpoint(path, false); }
+
+  /**
+   * Restores the results of an earlier run, which saveCheckpoint() has saved
+   * after solve(), for a program that may have changed since, e.g. in another
+   * process. Methods whose IR hash differs from the saved one or that no
+   * longer exist are invalidated along with their transitive callers as by
+   * invalidate(): their saved state is dropped and solveIncrementally()
+   * recomputes it, while the state of all other methods is reused. Only the
+   * keys of the facts and edge functions that are reused must still be valid.
+   * Must be called on a solver that has not solved yet. Throws a
+   * std::runtime_error if the file cannot be read.
+   */
+  void loadIncrementally(const std::string &path) {
+    checkpointRestored = true;
+    readCheckpoint(path, true);
+  }
+
+  /**
+   * Shares end summaries with other solvers through the given store, which
+   * must outlive the solver. The end summaries of the calling contexts the
+   * solver has analyzed are added to the store as soon as their methods are
+   * finished, see SolverConfiguration::endSummaryPublishInterval, and once
+   * solve() has solved the problem completely. Calls into contexts that are
+   * summarized in the store are not analyzed, but the summaries are applied.
+   * Contexts at the solver's own seeds are neither added nor looked up, as
+   * their summaries include the effects of the seeds. The store must only be
+   * shared among solvers of the same problem and configuration on the same
+   * program, and it is not affected by invalidate().
+   */
+  void setSharedEndSummaries(SharedSummaries *summaries) {
+    sharedEndSummaries = summaries;
+  }
+
+  /**
+   * Exports the end summaries of all calling contexts the solver has
+   * analyzed, along with the imported ones, see importSummaries(). Each
+   * method's summaries are keyed by its name and the hash of its IR and the
+   * IR of its transitive callees, such that different versions of a method
+   * coexist; nodes are saved by their position in the method, facts and edge
+   * functions by the keys of the problem, see IFDSTabulationProblem::DtoKey().
+   * Contexts whose facts or edge functions have no key are skipped. The file
+   * is replaced atomically. Throws a std::runtime_error and leaves the file
+   * as it is if it cannot be written. Must only be called after solve() has
+   * solved the problem completely.
+   */
+  void exportSummaries(const std::string &path) {
+    auto &lg = lg::get();
+    // the imported end summaries are kept, such that those of the methods of
+    // other programs survive
+    std::map<std::pair<std::string, uint64_t>, PersistedMethod> methods =
+        persistedMethods;
+    std::unordered_map<uint64_t, std::vector<std::pair<uint64_t,
+                                                       EdgeFunctionRef<V>>>>
+        contexts;
+    {
+      std::lock_guard<std::mutex> lock(summaryMutex);
+      forEachEndSummary(
+          [&](uint64_t start, uint64_t exit, EdgeFunctionRef<V> f) {
+            contexts[start].emplace_back(exit, f);
+          });
+      // contexts from which no exit is reached have no end summaries
+      for (auto &start : incomingtab) {
+        contexts[start.first];
+      }
+    }
+    std::unordered_map<M, std::unordered_map<N, uint64_t>> positions;
+    auto position = [&](M m, N n) {
+      auto &position = positions[m];
+      if (position.empty()) {
+        for (N inst : icfg.getAllInstructionsOf(m)) {
+          position.emplace(inst, position.size());
+        }
+      }
+      return position.at(n);
+    };
+    size_t numExported = 0;
+    size_t numSkipped = 0;
+    for (auto &context : contexts) {
+      N sP = nodeIds->get(unpackFirstId(context.first));
+      D d1 = factIds->get(unpackSecondId(context.first));
+      M m = icfg.getMethodOf(sP);
+      std::vector<PersistedExit> exits;
+      std::string fact;
+      try {
+        fact = ideTabulationProblem.DtoKey(d1);
+        for (auto &exit : context.second) {
+          exits.push_back(
+              {position(m, nodeIds->get(unpackFirstId(exit.first))),
+               ideTabulationProblem.DtoKey(
+                   factIds->get(unpackSecondId(exit.first))),
+               ideTabulationProblem.EFtoKey(exit.second.ptr())});
+        }
+      } catch (std::runtime_error &) {
+        ++numSkipped;
+        continue;
+      }
+      PersistedMethod &method =
+          methods[std::make_pair(icfg.getMethodName(m), summaryHash(m))];
+      method.contexts.emplace(std::make_pair(position(m, sP), fact),
+                              std::move(exits));
+      ++numExported;
+    }
+    // facts and edge functions are saved once in a table of keys
+    std::map<std::string, uint64_t> keyIndex;
+    std::vector<const std::string *> keys;
+    auto key = [&](const std::string &k) {
+      auto inserted = keyIndex.emplace(k, keys.size());
+      if (inserted.second) {
+        keys.push_back(&inserted.first->first);
+      }
+      return inserted.first->second;
+    };
+    for (auto &method : methods) {
+      for (auto &context : method.second.contexts) {
+        key(context.first.second);
+        for (auto &exit : context.second) {
+          key(exit.fact);
+          key(exit.function);
+        }
+      }
+    }
+    std::string tmpPath = path + ".tmp";
+    {
+      std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+      BinaryWriter out(file);
+      out.writeString(SummaryMagic);
+      out.writeInt(SummaryVersion);
+      out.writeInt(keys.size());
+      for (const std::string *k : keys) {
+        out.writeString(*k);
+      }
+      out.writeInt(methods.size());
+      for (auto &method : methods) {
+        out.writeString(method.first.first);
+        out.writeInt(method.first.second);
+        out.writeInt(method.second.contexts.size());
+        for (auto &context : method.second.contexts) {
+          out.writeInt(context.first.first);
+          out.writeInt(key(context.first.second));
+          out.writeInt(context.second.size());
+          for (auto &exit : context.second) {
+            out.writeInt(exit.exit);
+            out.writeInt(key(exit.fact));
+            out.writeInt(key(exit.function));
+          }
+        }
+      }
+      file.flush();
+      if (!out.good()) {
+        file.close();
+        std::remove(tmpPath.c_str());
+        throw std::runtime_error("Could not write summaries " + tmpPath);
+      }
+    }
+    if (std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+      std::remove(tmpPath.c_str());
+      throw std::runtime_error("Could not replace summaries " + path);
+    }
+    BOOST_LOG_SEV(lg, INFO) << "Exported " << numExported
+                            << " summarized calling contexts to " << path;
+    if (numSkipped > 0) {
+      BOOST_LOG_SEV(lg, WARNING)
+          << "Skipped " << numSkipped
+          << " calling contexts whose facts or edge functions have no key";
+    }
+  }
+
+  /**
+   * Imports the end summaries exported by exportSummaries(). The summaries of
+   * the methods that exist in the analyzed program and whose hash matches
+   * are applied at calls to them, such that these methods are not analyzed
+   * again for the summarized calling contexts. Must be called before
+   * solve(). Throws a std::runtime_error and imports nothing if the file
+   * cannot be read or its keys cannot be decoded.
+   */
+  void importSummaries(const std::string &path) {
+    auto &lg = lg::get();
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+      throw std::runtime_error("Could not open summaries " + path);
+    }
+    BinaryReader in(file);
+    if (in.readString() != SummaryMagic || in.readInt() != SummaryVersion) {
+      throw std::runtime_error(path + " does not hold summaries of this "
+                                      "version");
+    }
+    std::vector<std::string> keys(in.readInt());
+    for (std::string &k : keys) {
+      k = in.readString();
+    }
+    auto key = [&]() -> const std::string & {
+      uint64_t index = in.readInt();
+      if (index >= keys.size()) {
+        throw std::runtime_error("Malformed summaries");
+      }
+      return keys[index];
+    };
+    // nothing is imported until the whole file has been decoded
+    std::map<std::pair<std::string, uint64_t>, PersistedMethod> parsed;
+    std::unordered_map<
+        uint64_t, std::set<typename Table<N, D, EdgeFunctionRef<V>>::Cell>>
+        imported;
+    size_t numMethods = in.readInt();
+    for (size_t i = 0; i < numMethods; ++i) {
+      PersistedMethod method;
+      std::string name = in.readString();
+      uint64_t hash = in.readInt();
+      size_t numContexts = in.readInt();
+      for (size_t j = 0; j < numContexts; ++j) {
+        uint64_t start = in.readInt();
+        const std::string &fact = key();
+        auto &exits = method.contexts[std::make_pair(start, fact)];
+        exits.resize(in.readInt());
+        for (PersistedExit &exit : exits) {
+          exit.exit = in.readInt();
+          exit.fact = key();
+          exit.function = key();
+        }
+      }
+      parsed[std::make_pair(name, hash)] = std::move(method);
+    }
+    if (!in.atEnd()) {
+      throw std::runtime_error("Malformed summaries");
+    }
+    size_t numApplicable = 0;
+    for (auto &method : parsed) {
+      M m = icfg.getMethod(method.first.first);
+      if (!m || summaryHash(m) != method.first.second) {
+        continue;
+      }
+      std::vector<N> instructions = icfg.getAllInstructionsOf(m);
+      auto node = [&](uint64_t position) {
+        if (position >= instructions.size()) {
+          throw std::runtime_error("Malformed summaries");
+        }
+        return instructions[position];
+      };
+      for (auto &context : method.second.contexts) {
+        std::set<typename Table<N, D, EdgeFunctionRef<V>>::Cell> summaries;
+        for (auto &exit : context.second) {
+          summaries.emplace(
+              node(exit.exit), ideTabulationProblem.KeytoD(exit.fact),
+              edgeFunctionFactory.intern(
+                  ideTabulationProblem.KeytoEF(exit.function)));
+        }
+        N sP = node(context.first.first);
+        D d1 = ideTabulationProblem.KeytoD(context.first.second);
+        imported[packIds(nodeIds->getOrCreateId(sP),
+                         factIds->getOrCreateId(d1))] = std::move(summaries);
+      }
+      ++numApplicable;
+    }
+    persistedMethods = std::move(parsed);
+    importedSummaries = std::move(imported);
+    BOOST_LOG_SEV(lg, INFO) << "Imported the summaries of " << numApplicable
+                            << " of " << persistedMethods.size()
+                            << " methods from " << path;
+  }
+
+  /**
+   * Returns true if the fact d holds at the statement n, i.e. if the node
+   * (n, d) of the exploded super graph is reachable from the initial seeds.
+   *
+   * Instead of computing the exhaustive solution, the query processes path
+   * edges only until (n, d) has been reached. The jump functions and end
+   * summaries computed so far, as well as the path edges that are still
+   * pending, are kept and reused by subsequent queries, such that each part
+   * of the exploded super graph is explored at most once. Only a negative
+   * answer requires the complete exploration. solve() may be called after
+   * queries and completes the exploration.
+   *
+   * Values are not computed by queries. Queries are answered exhaustively if
+   * path edges are processed by multiple threads, and disable the collection
+   * of jump functions, see SolverConfiguration::jumpFunctionGCInterval.
+   */
+  bool query(N n, D d) {
+    auto &lg = lg::get();
+    if (holdsAt(n, d)) {
+      return true;
+    }
+    if (queryExplorationDone) {
+      return false;
+    }
+    if (jumpFunctionGCInterval > 0) {
+      BOOST_LOG_SEV(lg, WARNING) << "Jump functions are not collected, as "
+                                    "they answer subsequent queries";
+      jumpFunctionGCInterval = 0;
+    }
+    queryNode = n;
+    queryFact = d;
+    // concurrently processed path edges are drained completely, as are those
+    // of queries inside blocks, which have no jump functions of their own
+    queryActive = !parallelPathEdgeWorkList && !isInterior(n);
+    if (!querySeedsSubmitted) {
+      for (const auto &seed : initialSeeds) {
+        for (const D &value : seed.second) {
+          propagate(zeroValue, seed.first, value,
+                    edgeFunctionFactory.intern(EdgeIdentity<V>::getInstance()),
+                    nullptr, false);
+        }
+      }
+      querySeedsSubmitted = true;
+    }
+    processPathEdgeWorkList();
+    queryActive = false;
+    if (queryReached) {
+      queryReached = false;
+      return true;
+    }
+    // the exploded super graph has been explored completely
+    for (const auto &seed : initialSeeds) {
+      jumpFn->addFunction(
+          zeroValue, seed.first, zeroValue,
+          edgeFunctionFactory.intern(EdgeIdentity<V>::getInstance()));
+    }
+    queryExplorationDone = true;
+    return holdsAt(n, d);
+  }
+
   /**
    * Returns the V-type result for the given value at the given statement.
    * TOP values are never returned.
    */
-  V resultAt(N stmt, D value) { return valtab.get(stmt, value); }
+  V resultAt(N stmt, D value) {
+    computePendingValuesAt(stmt);
+    IdType stmtId = nodeIds->getId(stmt);
+    IdType valueId = factIds->getId(value);
+    if (stmtId >= valtab.size() || !valtab[stmtId].count(valueId)) {
+      return V();
+    }
+    return valtab[stmtId][valueId];
+  }
 
   /**
    * Returns the resulting environment for the given statement.
@@ -279,28 +1070,64 @@ public:
    * TOP values are never returned.
    */
   std::unordered_map<D, V> resultsAt(N stmt, bool stripZero = false) {
-    std::unordered_map<D, V> result = valtab.row(stmt);
-    if (stripZero) {
-      for (auto &pair : result) {
-        if (ideTabulationProblem.isZeroValue(pair.first))
-          result.erase(pair.first);
+    std::unordered_map<D, V> result;
+    computePendingValuesAt(stmt);
+    IdType stmtId = nodeIds->getId(stmt);
+    if (stmtId >= valtab.size()) {
+      return result;
+    }
+    for (auto &entry : valtab[stmtId]) {
+      D fact = factIds->get(entry.first);
+      if (!stripZero || !ideTabulationProblem.isZeroValue(fact)) {
+        result.insert({fact, entry.second});
       }
     }
     return result;
   }
 
+  /**
+   * Returns how often a jump function has been refined by joining it with a
+   * newly propagated edge function. Each refinement leads to the path edge
+   * being processed again, a good scheduling strategy keeps this low.
+   */
+  size_t getNumJumpFunctionRejoins() const { return numJumpFunctionRejoins; }
+
+  /**
+   * Returns all (node, fact, value) triples computed by the solver.
+   */
+  std::set<typename Table<N, D, V>::Cell> valtabCellSet() {
+    std::set<typename Table<N, D, V>::Cell> cells;
+    for (IdType n : pendingValueNodes) {
+      computeValuesAt(nodeIds->get(n));
+    }
+    pendingValueNodes.clear();
+    for (IdType n = 0; n < valtab.size(); ++n) {
+      for (auto &entry : valtab[n]) {
+        cells.insert(typename Table<N, D, V>::Cell(
+            nodeIds->get(n), factIds->get(entry.first), entry.second));
+      }
+    }
+    return cells;
+  }
+
 private:
+  static constexpr const char *CheckpointMagic = "phasar-ide-checkpoint";
+  static constexpr uint64_t CheckpointVersion = 2;
+  static constexpr const char *SummaryMagic = "phasar-ide-summaries";
+  static constexpr uint64_t SummaryVersion = 1;
+
   std::unique_ptr<IFDSToIDETabulationProblem<N, D, M, I>> transformedProblem;
   IDETabulationProblem<N, D, M, V, I> &ideTabulationProblem;
   FlowEdgeFunctionCache<N, D, M, V, I> cachedFlowEdgeFunctions;
   bool recordEdges;
 
-  void saveEdges(N sourceNode, N sinkStmt, D sourceVal, std::set<D> destVals,
-                 bool interP) {
+  void saveEdges(N sourceNode, N sinkStmt, D sourceVal,
+                 const FFSet<D> &destVals, bool interP) {
     PAMM_FACTORY;
     // ADD_TO_HIST("Data-flow facts", destVals.size());
     if (!recordEdges)
       return;
+    std::lock_guard<std::mutex> lock(recordMutex);
     Table<N, N, std::map<D, std::set<D>>> &tgtMap =
         (interP) ? computedInterPathEdges : computedIntraPathEdges;
     tgtMap.get(sourceNode, sinkStmt)[sourceVal].insert(destVals.begin(),
@@ -335,7 +1162,7 @@ private:
     D d1 = edge.factAtSource();
     N n = edge.getTarget(); // a call node; line 14...
     D d2 = edge.factAtTarget();
-    std::shared_ptr<EdgeFunction<V>> f = jumpFunction(edge);
+    EdgeFunctionRef<V> f = jumpFunction(edge);
     std::set<N> returnSiteNs = icfg.getReturnSitesOfCallAt(n);
     ADD_TO_HIST("IDESolver", returnSiteNs.size());
     std::set<M> callees = icfg.getCalleesOfCallAt(n);
@@ -359,7 +1186,7 @@ private:
         BOOST_LOG_SEV(lg, DEBUG) << "Found and process special summary";
         for (N returnSiteN : returnSiteNs) {
           INC_COUNTER("SpecialSummaryFFApplicationCount");
-          std::set<D> res = computeSummaryFlowFunction(specialSum, d1, d2);
+          FFSet<D> res = computeSummaryFlowFunction(specialSum, d1, d2);
           INC_COUNTER("SpecialSummary-FF Application");
           ADD_TO_HIST("Data-flow facts", res.size());
           saveEdges(n, returnSiteN, d2, res, false);
@@ -368,7 +1195,8 @@ private:
                 cachedFlowEdgeFunctions.getSummaryEdgeFunction(n, d2,
                                                                returnSiteN, d3);
             INC_COUNTER("SpecialSummary-EF Queries");
-            propagate(d1, returnSiteN, d3, f->composeWith(sumEdgFnE), n, false);
+            propagate(d1, returnSiteN, d3,
+                      edgeFunctionFactory.compose(f, sumEdgFnE), n, false);
           }
         }
       } else {
@@ -376,7 +1204,7 @@ private:
         std::shared_ptr<FlowFunction<D>> function =
             cachedFlowEdgeFunctions.getCallFlowFunction(n, sCalledProcN);
         INC_COUNTER("FF Queries");
-        std::set<D> res = computeCallFlowFunction(function, d1, d2);
+        FFSet<D> res = computeCallFlowFunction(function, d1, d2);
         ADD_TO_HIST("Data-flow facts", res.size());
         // for each callee's start point(s)
         std::set<N> startPointsOf = icfg.getStartPointsOf(sCalledProcN);
@@ -391,19 +1219,44 @@ private:
           saveEdges(n, sP, d2, res, true);
           // for each result node of the call-flow function
           for (D d3 : res) {
-            // create initial self-loop
-            propagate(d3, sP, d3, EdgeIdentity<V>::getInstance(), n,
-                      false); // line 15
-            // register the fact that <sp,d3> has an incoming edge from <n,d2>
-            // line 15.1 of Naeem/Lhotak/Rodriguez
-            addIncoming(sP, d3, n, d2);
-            // line 15.2, copy to avoid concurrent modification exceptions by
-            // other threads
             std::set<
-                typename Table<N, D, std::shared_ptr<EdgeFunction<V>>>::Cell>
-                endSumm = std::set<typename Table<
-                    N, D, std::shared_ptr<EdgeFunction<V>>>::Cell>(
-                    endSummary(sP, d3));
+                typename Table<N, D, EdgeFunctionRef<V>>::Cell>
+                endSumm;
+            auto imported = importedSummaries.empty()
+                                ? importedSummaries.end()
+                                : importedSummaries.find(packIds(
+                                      nodeIds->getOrCreateId(sP),
+                                      factIds->getOrCreateId(d3)));
+            const std::vector<typename SharedEndSummaries<N, D, V>::Exit>
+                *shared = nullptr;
+            if (imported != importedSummaries.end()) {
+              // the callee has been summarized for <sP,d3> by an earlier run
+              // and is not analyzed again
+              endSumm = imported->second;
+            } else if (sharedEndSummaries && !initialSeeds.count(sP) &&
+                       (shared = sharedEndSummaries->find(sP, d3))) {
+              // the callee has been summarized for <sP,d3> by another solver
+              for (auto &exit : *shared) {
+                endSumm.emplace(exit.Node, exit.Fact,
+                                edgeFunctionFactory.intern(exit.Function));
+              }
+            } else {
+              // create initial self-loop
+              propagate(
+                  d3, sP, d3,
+                  edgeFunctionFactory.intern(EdgeIdentity<V>::getInstance()),
+                  n, false); // line 15
+              // registering the incoming edge and querying the end summaries
+              // must happen atomically, see processExit()
+              std::lock_guard<std::mutex> lock(summaryMutex);
+              // register the fact that <sp,d3> has an incoming edge from
+              // <n,d2>
+              // line 15.1 of Naeem/Lhotak/Rodriguez
+              addIncoming(sP, d3, n, d2);
+              // line 15.2, copy to avoid concurrent modification exceptions
+              // by other threads
+              endSumm = endSummary(sP, d3);
+            }
             ADD_TO_HIST("IDESolver", endSumm.size());
             // std::cout << "ENDSUMM" << std::endl;
             // sP->dump();
@@ -414,11 +1267,11 @@ private:
             // <sP,d3>, create new caller-side jump functions to the return
             // sites because we have observed a potentially new incoming
             // edge into <sP,d3>
-            for (typename Table<N, D, std::shared_ptr<EdgeFunction<V>>>::Cell
+            for (typename Table<N, D, EdgeFunctionRef<V>>::Cell
                      entry : endSumm) {
               N eP = entry.getRowKey();
               D d4 = entry.getColumnKey();
-              std::shared_ptr<EdgeFunction<V>> fCalleeSummary =
+              EdgeFunctionRef<V> fCalleeSummary =
                   entry.getValue();
               // for each return site
               for (N retSiteN : returnSiteNs) {
@@ -427,8 +1280,8 @@ private:
                     cachedFlowEdgeFunctions.getRetFlowFunction(n, sCalledProcN,
                                                                eP, retSiteN);
                 INC_COUNTER("FF Queries");
-                std::set<D> returnedFacts = computeReturnFlowFunction(
-                    retFunction, d3, d4, n, std::set<D>{d2});
+                FFSet<D> returnedFacts = computeReturnFlowFunction(
+                    retFunction, d3, d4, n, FFSet<D>{d2});
                 ADD_TO_HIST("Data-flow facts", returnedFacts.size());
                 saveEdges(eP, retSiteN, d4, returnedFacts, true);
                 // for each target value of the function
@@ -444,12 +1297,14 @@ private:
                           n, sCalledProcN, eP, d4, retSiteN, d5);
                   INC_COUNTER_BY_VAL("EF Queries", 2);
                   // compose call * calleeSummary * return edge functions
-                  std::shared_ptr<EdgeFunction<V>> fPrime =
-                      f4->composeWith(fCalleeSummary)->composeWith(f5);
+                  EdgeFunctionRef<V> fPrime = edgeFunctionFactory.compose(
+                      edgeFunctionFactory.compose(
+                          edgeFunctionFactory.intern(f4), fCalleeSummary),
+                      f5);
                   D d5_restoredCtx = restoreContextOnReturnedFact(n, d2, d5);
                   // prpagte the effects of the entire call
                   propagate(d1, retSiteN, d5_restoredCtx,
-                            f->composeWith(fPrime), n, false);
+                            edgeFunctionFactory.compose(f, fPrime), n, false);
                 }
               }
             }
@@ -463,7 +1318,7 @@ private:
             cachedFlowEdgeFunctions.getCallToRetFlowFunction(n, returnSiteN,
                                                              callees);
         INC_COUNTER("FF Queries");
-        std::set<D> returnFacts =
+        FFSet<D> returnFacts =
             computeCallToReturnFlowFunction(callToReturnFlowFunction, d1, d2);
         ADD_TO_HIST("Data-flow facts", returnFacts.size());
         saveEdges(n, returnSiteN, d2, returnFacts, false);
@@ -472,7 +1327,8 @@ private:
               cachedFlowEdgeFunctions.getCallToReturnEdgeFunction(
                   n, d2, returnSiteN, d3);
           INC_COUNTER("EF Queries");
-          propagate(d1, returnSiteN, d3, f->composeWith(edgeFnE), n, false);
+          propagate(d1, returnSiteN, d3,
+                    edgeFunctionFactory.compose(f, edgeFnE), n, false);
         }
       }
     }
@@ -483,7 +1339,9 @@ private:
    * Simply propagate normal, intra-procedural flows.
    * @param edge
    */
-  void processNormalFlow(PathEdge<N, D> edge) {
+  void processNormalFlow(
+      PathEdge<N, D> edge,
+      const std::map<N, std::map<D, FFSet<D>>> *batchTargets = nullptr) {
     PAMM_FACTORY;
     INC_COUNTER("Process Normal");
     auto &lg = lg::get();
@@ -493,22 +1351,229 @@ private:
     D d1 = edge.factAtSource();
     N n = edge.getTarget();
     D d2 = edge.factAtTarget();
-    std::shared_ptr<EdgeFunction<V>> f = jumpFunction(edge);
-    auto successorInst = icfg.getSuccsOf(n);
-    for (auto m : successorInst) {
-      std::shared_ptr<FlowFunction<D>> flowFunction =
-          cachedFlowEdgeFunctions.getNormalFlowFunction(n, m);
-      INC_COUNTER("FF Queries");
-      std::set<D> res = computeNormalFlowFunction(flowFunction, d1, d2);
-      ADD_TO_HIST("Data-flow facts", res.size());
-      saveEdges(n, m, d2, res, false);
+    EdgeFunctionRef<V> f = jumpFunction(edge);
+    // the facts that arrive at the successors; facts arriving inside blocks
+    // are carried on rather than propagated, see isInterior()
+    std::vector<std::pair<N, std::map<D, EdgeFunctionRef<V>>>> arrivals;
+    for (N m : icfg.getSuccsOf(n)) {
+      arrivals.emplace_back(m, std::map<D, EdgeFunctionRef<V>>());
+      applyNormalFlow(d1, n, m, {{d2, f}}, arrivals.back().second, true,
+                      batchTargets ? &batchTargets->at(m) : nullptr);
+    }
+    while (!arrivals.empty()) {
+      N m = arrivals.back().first;
+      std::map<D, EdgeFunctionRef<V>> facts;
+      facts.swap(arrivals.back().second);
+      arrivals.pop_back();
+      bool blockInterior = blockwisePropagation && isBlockInterior(m);
+      bool sparseInterior =
+          sparsePropagation && (blockInterior || isSparseInterior(m));
+      if (!blockInterior && !sparseInterior) {
+        for (auto &fact : facts) {
+          propagate(d1, m, fact.first, fact.second, nullptr, false);
+        }
+        continue;
+      }
+      // facts that m does not affect are passed on as they are, the flow
+      // functions of m are applied to the others inside a block
+      std::map<D, EdgeFunctionRef<V>> unaffected;
+      std::map<D, EdgeFunctionRef<V>> affected;
+      for (auto &fact : facts) {
+        if (sparseInterior && !isAffectedAt(m, fact.first)) {
+          unaffected.insert(fact);
+        } else if (blockInterior) {
+          affected.insert(fact);
+        } else {
+          propagate(d1, m, fact.first, fact.second, nullptr, false);
+        }
+      }
+      if (unaffected.empty() && affected.empty()) {
+        continue;
+      }
+      for (N succ : icfg.getSuccsOf(m)) {
+        arrivals.emplace_back(succ, unaffected);
+        applyNormalFlow(d1, m, succ, affected, arrivals.back().second);
+      }
+    }
+  }
+
+  /**
+   * Processes path edges to the same node n, which is neither a call nor an
+   * exit, such that the normal flow functions from n to its successors are
+   * applied to all of their facts at once.
+   */
+  void processNormalFlowBatch(std::vector<PathEdge<N, D>> &edges) {
+    N n = edges.front().getTarget();
+    FFSet<D> sources;
+    for (PathEdge<N, D> &edge : edges) {
+      sources.insert(edge.factAtTarget());
+    }
+    std::map<N, std::map<D, FFSet<D>>> batchTargets;
+    for (N m : icfg.getSuccsOf(n)) {
+      batchTargets[m] = computeNormalFlowFunctionBatch(
+          cachedFlowEdgeFunctions.getNormalFlowFunction(n, m), sources);
+    }
+    for (PathEdge<N, D> &edge : edges) {
+      processNormalFlow(edge, &batchTargets);
+    }
+  }
+
+  /**
+   * Applies the normal flow and edge functions from n to its successor m to
+   * the facts at n and their functions, and joins the results into those at
+   * m. The edges are recorded unless they are only being reconstructed. The
+   * targets of the facts are looked up in batchTargets if given.
+   */
+  void applyNormalFlow(D d1, N n, N m,
+                       const std::map<D, EdgeFunctionRef<V>> &facts,
+                       std::map<D, EdgeFunctionRef<V>> &successorFacts,
+                       bool record = true,
+                       const std::map<D, FFSet<D>> *batchTargets = nullptr) {
+    if (facts.empty()) {
+      return;
+    }
+    std::map<D, FFSet<D>> targets;
+    if (!batchTargets && batchFlowFunctions && facts.size() > 1) {
+      FFSet<D> sources;
+      for (auto &fact : facts) {
+        sources.insert(fact.first);
+      }
+      targets = computeNormalFlowFunctionBatch(
+          cachedFlowEdgeFunctions.getNormalFlowFunction(n, m), sources);
+      batchTargets = &targets;
+    }
+    std::shared_ptr<FlowFunction<D>> flowFunction =
+        batchTargets ? nullptr
+                     : cachedFlowEdgeFunctions.getNormalFlowFunction(n, m);
+    INC_COUNTER("FF Queries");
+    for (auto &fact : facts) {
+      FFSet<D> res =
+          batchTargets
+              ? batchTargets->at(fact.first)
+              : computeNormalFlowFunction(flowFunction, d1, fact.first);
+      if (record) {
+        ADD_TO_HIST("Data-flow facts", res.size());
+        saveEdges(n, m, fact.first, res, false);
+      }
       for (D d3 : res) {
-        std::shared_ptr<EdgeFunction<V>> fprime = f->composeWith(
-            cachedFlowEdgeFunctions.getNormalEdgeFunction(n, d2, m, d3));
+        EdgeFunctionRef<V> fprime = edgeFunctionFactory.compose(
+            fact.second, cachedFlowEdgeFunctions.getNormalEdgeFunction(
+                             n, fact.first, m, d3));
         INC_COUNTER("EF Queries");
-        propagate(d1, m, d3, fprime, nullptr, false);
+        joinInto(successorFacts, d3, fprime);
+      }
+    }
+  }
+
+  void joinInto(std::map<D, EdgeFunctionRef<V>> &facts, D d,
+                EdgeFunctionRef<V> f) {
+    auto inserted = facts.emplace(d, f);
+    if (!inserted.second) {
+      inserted.first->second =
+          edgeFunctionFactory.join(inserted.first->second, f);
+    }
+  }
+
+  /// Returns true if path edges to n are only subject to normal flow, i.e.
+  /// if n is neither a call nor an exit and has successors.
+  bool isNormalFlowOnly(N n) {
+    return !icfg.isCallStmt(n) && !icfg.isExitStmt(n) &&
+           !icfg.getSuccsOf(n).empty();
+  }
+
+  /**
+   * Returns true if n has a single predecessor that is not a call, and n
+   * itself is neither a call, an exit nor a start point or seed. Facts
+   * arriving at such a node along its only incoming edge may be carried on
+   * without storing jump functions at n.
+   */
+  bool isSparseInterior(N n) {
+    if (icfg.isCallStmt(n) || icfg.isExitStmt(n) || icfg.isStartPoint(n) ||
+        initialSeeds.count(n) || icfg.getSuccsOf(n).empty()) {
+      return false;
+    }
+    auto preds = icfg.getPredsOf(n);
+    return preds.size() == 1 && !icfg.isCallStmt(preds.front());
+  }
+
+  /**
+   * Returns true if n is inside a straight-line block, i.e. if additionally
+   * its predecessor has no other successors. With blockwise propagation, no
+   * jump functions are stored at such nodes.
+   */
+  bool isBlockInterior(N n) {
+    return isSparseInterior(n) &&
+           icfg.getSuccsOf(icfg.getPredsOf(n).front()).size() == 1;
+  }
+
+  /// Returns true if the jump functions at n are not stored, or not for all
+  /// facts, by blockwise or sparse propagation.
+  bool isInterior(N n) {
+    return (blockwisePropagation && isBlockInterior(n)) ||
+           (sparsePropagation && isSparseInterior(n));
+  }
+
+  /// Returns false if sparse propagation may pass d past n unchanged.
+  bool isAffectedAt(N n, D d) {
+    return ideTabulationProblem.isZeroValue(d) ||
+           ideTabulationProblem.mayAffect(n, d);
+  }
+
+  /**
+   * Returns the jump functions at n as a mapping from the source value to
+   * the target values and their functions. With blockwise or sparse
+   * propagation, the jump functions at an interior node are reconstructed
+   * from those at the nearest preceding node that is not interior by
+   * applying the flow and edge functions up to n.
+   */
+  std::map<D, std::map<D, EdgeFunctionRef<V>>> jumpFunctionsAt(N n) {
+    std::map<D, std::map<D, EdgeFunctionRef<V>>> result;
+    std::vector<N> path{n};
+    // unreachable code may form cycles of interior nodes, which hold no facts
+    std::unordered_set<N> visited{n};
+    while (isInterior(path.back())) {
+      N pred = icfg.getPredsOf(path.back()).front();
+      if (!visited.insert(pred).second) {
+        return result;
+      }
+      path.push_back(pred);
+    }
+    for (auto entry : jumpFn->lookupByTarget(path.back())) {
+      result[entry.sourceVal][entry.targetVal] = entry.function;
+    }
+    for (size_t i = path.size() - 1; i > 0; --i) {
+      N pred = path[i];
+      N succ = path[i - 1];
+      for (auto &sourceAndFacts : result) {
+        std::map<D, EdgeFunctionRef<V>> unaffected;
+        std::map<D, EdgeFunctionRef<V>> affected;
+        for (auto &fact : sourceAndFacts.second) {
+          if (sparsePropagation && !isAffectedAt(pred, fact.first)) {
+            unaffected.insert(fact);
+          } else {
+            affected.insert(fact);
+          }
+        }
+        applyNormalFlow(sourceAndFacts.first, pred, succ, affected,
+                        unaffected, false);
+        sourceAndFacts.second.swap(unaffected);
+      }
+    }
+    return result;
+  }
+
+  /// Returns true if a jump function to (n, d) exists, or can be
+  /// reconstructed at an interior node.
+  bool holdsAt(N n, D d) {
+    if (!isInterior(n)) {
+      return !jumpFn->reverseLookup(n, d).empty();
+    }
+    for (auto &sourceAndFacts : jumpFunctionsAt(n)) {
+      if (sourceAndFacts.second.count(d)) {
+        return true;
       }
     }
+    return false;
   }
 
   void propagateValueAtStart(std::pair<N, D> nAndD, N n) {
@@ -517,8 +1582,8 @@ private:
     M p = icfg.getMethodOf(n);
     for (N c : icfg.getCallsFromWithin(p)) {
       for (auto entry : jumpFn->forwardLookup(d, c)) {
-        D dPrime = entry.first;
-        std::shared_ptr<EdgeFunction<V>> fPrime = entry.second;
+        D dPrime = entry.targetVal;
+        EdgeFunctionRef<V> fPrime = entry.function;
         N sP = n;
         V value = val(sP, d);
         propagateValue(c, dPrime, fPrime->computeTarget(value));
@@ -531,10 +1596,14 @@ private:
     PAMM_FACTORY;
     D d = nAndD.second;
     for (M q : icfg.getCalleesOfCallAt(n)) {
+      // as in Phase I, callees with a special summary are not entered
+      if (cachedFlowEdgeFunctions.getSummaryFlowFunction(n, q)) {
+        continue;
+      }
       std::shared_ptr<FlowFunction<D>> callFlowFunction =
           cachedFlowEdgeFunctions.getCallFlowFunction(n, q);
       INC_COUNTER("FF Queries");
-      for (D dPrime : callFlowFunction->computeTargets(d)) {
+      for (D dPrime : callFlowFunction->computeTargetSet(d)) {
         std::shared_ptr<EdgeFunction<V>> edgeFn =
             cachedFlowEdgeFunctions.getCallEdgeFunction(n, d, q, dPrime);
         INC_COUNTER("EF Queries");
@@ -551,17 +1620,20 @@ private:
     V vPrime = joinValueAt(nHashN, nHashD, valNHash, v);
     if (!(vPrime == valNHash)) {
       setVal(nHashN, nHashD, vPrime);
-      valuePropagationTask(std::pair<N, D>(nHashN, nHashD));
+      valuePropagationWorkList.push_back(std::pair<N, D>(nHashN, nHashD));
     }
   }
 
   V val(N nHashN, D nHashD) {
-    if (valtab.contains(nHashN, nHashD)) {
-      return valtab.get(nHashN, nHashD);
-    } else {
-      // implicitly initialized to top; see line [1] of Fig. 7 in SRH96 paper
-      return ideTabulationProblem.topElement();
+    IdType n = nodeIds->getId(nHashN);
+    if (n < valtab.size()) {
+      auto search = valtab[n].find(factIds->getId(nHashD));
+      if (search != valtab[n].end()) {
+        return search->second;
+      }
     }
+    // implicitly initialized to top; see line [1] of Fig. 7 in SRH96 paper
+    return ideTabulationProblem.topElement();
   }
 
   void setVal(N nHashN, D nHashD, V l) {
@@ -569,9 +1641,16 @@ private:
     // TOP is the implicit default value which we do not need to store.
     if (l == ideTabulationProblem.topElement()) {
       // do not store top values
-      valtab.remove(nHashN, nHashD);
+      IdType n = nodeIds->getId(nHashN);
+      if (n < valtab.size()) {
+        valtab[n].erase(factIds->getId(nHashD));
+      }
     } else {
-      valtab.insert(nHashN, nHashD, l);
+      IdType n = nodeIds->getOrCreateId(nHashN);
+      if (n >= valtab.size()) {
+        valtab.resize(nodeIds->size());
+      }
+      valtab[n][factIds->getOrCreateId(nHashD)] = l;
     }
     BOOST_LOG_SEV(lg, DEBUG)
         << "VALUE: " << icfg.getMethodOf(nHashN)->getName().str() << " "
@@ -580,32 +1659,801 @@ private:
         << "val: " << ideTabulationProblem.VtoString(l);
   }
 
-  std::shared_ptr<EdgeFunction<V>> jumpFunction(PathEdge<N, D> edge) {
-    if (!jumpFn->forwardLookup(edge.factAtSource(), edge.getTarget())
-             .count(edge.factAtTarget())) {
-      // JumpFn initialized to all-top, see line [2] in SRH96 paper
-      return allTop;
-    }
-    return jumpFn->forwardLookup(edge.factAtSource(),
-                                 edge.getTarget())[edge.factAtTarget()];
+  EdgeFunctionRef<V> jumpFunction(PathEdge<N, D> edge) {
+    EdgeFunctionRef<V> f = jumpFn->getFunction(
+        edge.factAtSource(), edge.getTarget(), edge.factAtTarget());
+    // JumpFn initialized to all-top, see line [2] in SRH96 paper
+    return f ? f : allTop;
   }
 
   void addEndSummary(N sP, D d1, N eP, D d2,
-                     std::shared_ptr<EdgeFunction<V>> f) {
-    // note: at this point we don't need to join with a potential previous f
-    // because f is a jump function, which is already properly joined
-    // within propagate(..)
-    endsummarytab.get(sP, d1).insert(eP, d2, f);
+                     EdgeFunctionRef<V> f) {
+    // f is the jump function to the exit, which is read under summaryMutex
+    // and already joined with the previous ones within propagate(..)
+    uint64_t context =
+        packIds(nodeIds->getOrCreateId(sP), factIds->getOrCreateId(d1));
+    restoreEndSummaries(context);
+    endsummarytab[context][packIds(nodeIds->getOrCreateId(eP),
+                                   factIds->getOrCreateId(d2))] = f;
   }
 
-  // should be made a callable at some point
-  void pathEdgeProcessingTask(PathEdge<N, D> edge) {
-    PAMM_FACTORY;
-    auto &lg = lg::get();
-    INC_COUNTER("JumpFn Construction");
-    BOOST_LOG_SEV(lg, DEBUG)
-        << "Process path edge: <"
-        << "D source: " << ideTabulationProblem.DtoString(edge.factAtSource())
+  /**
+   * Processes path edges until the work list is exhausted. Processing a path
+   * edge may push new path edges, hence, the stack depth remains constant no
+   * matter how long the chains of propagations are.
+   */
+  void processPathEdgeWorkList() {
+    if (parallelPathEdgeWorkList) {
+      parallelPathEdgeWorkList->run(
+          [this](PathEdge<N, D> edge) {
+            ++numPathEdgesInSolve;
+            pathEdgeProcessingTask(edge);
+          },
+          [this] { return isInterrupted(); });
+      return;
+    }
+    // a query stops the processing as soon as it has been answered
+    while (!pathEdgeWorkList.empty() && !queryReached && !isInterrupted()) {
+      PathEdge<N, D> edge = pathEdgeWorkList.pop();
+      // the pending edges to the same node are processed together if the
+      // flow functions are applied in batches
+      std::vector<PathEdge<N, D>> batch;
+      if (batchFlowFunctions && isNormalFlowOnly(edge.getTarget())) {
+        batch.push_back(edge);
+        pathEdgeWorkList.popWhileTarget(edge.getTarget(), batch);
+      }
+      size_t numEdges = std::max<size_t>(batch.size(), 1);
+      numPathEdgesInSolve += numEdges;
+      auto &config = ideTabulationProblem.solver_config;
+      if (jumpFunctionGCInterval > 0) {
+        methodsToCollect.insert(icfg.getMethodOf(edge.getTarget()));
+      }
+      if (sharedEndSummaries && config.endSummaryPublishInterval > 0) {
+        methodsToPublish.insert(icfg.getMethodOf(edge.getTarget()));
+      }
+      if (maxInMemoryJumpFunctions > 0) {
+        numProcessedPathEdges += numEdges;
+        lastProcessedAt[icfg.getMethodOf(edge.getTarget())] =
+            numProcessedPathEdges;
+      }
+      if (batch.size() > 1) {
+        processNormalFlowBatch(batch);
+      } else {
+        pathEdgeProcessingTask(edge);
+      }
+      if (maxInMemoryJumpFunctions > 0 &&
+          jumpFn->numInMemoryFunctions() > maxInMemoryJumpFunctions) {
+        spillColdMethods();
+      }
+      if (jumpFunctionGCInterval > 0 &&
+          ((pathEdgesSinceGC += numEdges) >= jumpFunctionGCInterval ||
+           pathEdgeWorkList.empty())) {
+        collectFinishedMethods();
+        pathEdgesSinceGC = 0;
+      }
+      if (sharedEndSummaries && config.endSummaryPublishInterval > 0 &&
+          (pathEdgesSincePublish += numEdges) >=
+              config.endSummaryPublishInterval) {
+        publishFinishedMethods();
+        pathEdgesSincePublish = 0;
+      }
+      if (solveActive && config.checkpointInterval > 0 &&
+          !config.checkpointFile.empty() && !checkpointFailed &&
+          (pathEdgesSinceCheckpoint += numEdges) >=
+              config.checkpointInterval) {
+        trySaveCheckpoint(config.checkpointFile);
+        pathEdgesSinceCheckpoint = 0;
+      }
+    }
+  }
+
+  /**
+   * Returns true if solve() has to stop processing path edges, as it has been
+   * cancelled or one of its budgets is exhausted, and records the reason in
+   * status. The time and memory budgets are only checked every 1024 path
+   * edges.
+   */
+  bool isInterrupted() {
+    if (!solveActive) {
+      return false;
+    }
+    if (status != SolverStatus::Unsolved) {
+      return true;
+    }
+    auto &config = ideTabulationProblem.solver_config;
+    size_t processed = numPathEdgesInSolve;
+    SolverStatus reason = SolverStatus::Unsolved;
+    if (config.cancellationToken.isCancelled()) {
+      reason = SolverStatus::Cancelled;
+    } else if (config.maxPathEdges > 0 && processed >= config.maxPathEdges) {
+      reason = SolverStatus::PathEdgeLimitReached;
+    } else {
+      size_t nextCheck = nextResourceCheck;
+      if (processed < nextCheck ||
+          !nextResourceCheck.compare_exchange_strong(nextCheck,
+                                                     processed + 1024)) {
+        return false;
+      }
+      auto elapsed = std::chrono::steady_clock::now() - solveStart;
+      if (config.maxSolvingSeconds > 0 &&
+          elapsed >= std::chrono::seconds(config.maxSolvingSeconds)) {
+        reason = SolverStatus::TimeLimitReached;
+      } else if (config.maxResidentMemoryMB > 0 &&
+                 getResidentMemoryMB() >= config.maxResidentMemoryMB) {
+        reason = SolverStatus::MemoryLimitReached;
+      } else {
+        return false;
+      }
+    }
+    SolverStatus expected = SolverStatus::Unsolved;
+    status.compare_exchange_strong(expected, reason);
+    return true;
+  }
+
+  /// Returns the resident memory of the process, or 0 if it is unknown.
+  static size_t getResidentMemoryMB() {
+    std::ifstream statm("/proc/self/statm");
+    size_t size = 0;
+    size_t resident = 0;
+    if (!(statm >> size >> resident)) {
+      return 0;
+    }
+    return resident * static_cast<size_t>(sysconf(_SC_PAGESIZE)) /
+           (1024 * 1024);
+  }
+
+  /**
+   * Spills the jump functions and end summaries of the least recently
+   * processed methods until at most half of maxInMemoryJumpFunctions jump
+   * functions remain in memory. Spilled entries are read back on demand.
+   */
+  void spillColdMethods() {
+    auto &lg = lg::get();
+    std::vector<std::pair<size_t, M>> methods;
+    for (auto &entry : lastProcessedAt) {
+      methods.emplace_back(entry.second, entry.first);
+    }
+    std::sort(methods.begin(), methods.end(),
+              [](const std::pair<size_t, M> &lhs,
+                 const std::pair<size_t, M> &rhs) {
+                return lhs.first < rhs.first;
+              });
+    std::unordered_set<M> spilled;
+    size_t numSpilled = 0;
+    for (auto &method : methods) {
+      if (jumpFn->numInMemoryFunctions() <= maxInMemoryJumpFunctions / 2) {
+        break;
+      }
+      for (N n : icfg.getAllInstructionsOf(method.second)) {
+        numSpilled += jumpFn->evictFunctionsAt(n);
+      }
+      lastProcessedAt.erase(method.second);
+      spilled.insert(method.second);
+    }
+    std::lock_guard<std::mutex> lock(summaryMutex);
+    for (auto it = endsummarytab.begin(); it != endsummarytab.end();) {
+      if (!spilled.count(
+              icfg.getMethodOf(nodeIds->get(unpackFirstId(it->first))))) {
+        ++it;
+        continue;
+      }
+      std::vector<ColdEndSummary> cold;
+      for (auto &entry : it->second) {
+        cold.push_back({entry.first, entry.second.getOpaqueValue()});
+      }
+      if (!coldEndSummaryLog) {
+        coldEndSummaryLog = std::make_unique<MappedLog<ColdEndSummary>>(
+            ideTabulationProblem.solver_config.spillDirectory);
+      }
+      coldEndSummaries[it->first] = std::make_pair(
+          coldEndSummaryLog->append(cold.data(), cold.size()), cold.size());
+      it = endsummarytab.erase(it);
+    }
+    BOOST_LOG_SEV(lg, INFO) << "Spilled " << numSpilled
+                            << " jump functions of " << spilled.size()
+                            << " methods";
+  }
+
+  /// Loads the spilled end summaries of a context back into endsummarytab.
+  /// summaryMutex must be held.
+  void restoreEndSummaries(uint64_t context) {
+    if (coldEndSummaries.empty()) {
+      return;
+    }
+    auto search = coldEndSummaries.find(context);
+    if (search == coldEndSummaries.end()) {
+      return;
+    }
+    auto &summaries = endsummarytab[context];
+    for (size_t i = 0; i < search->second.second; ++i) {
+      const ColdEndSummary &cold =
+          (*coldEndSummaryLog)[search->second.first + i];
+      summaries.emplace(cold.exit,
+                        EdgeFunctionRef<V>::getFromOpaqueValue(cold.function));
+    }
+    coldEndSummaries.erase(search);
+  }
+
+  /**
+   * Reads a checkpoint written by saveCheckpoint(), see loadCheckpoint(). If
+   * invalidateChanged is set, the state of the methods that have changed
+   * since and of their transitive callers is skipped, see
+   * loadIncrementally(); otherwise, changed methods are an error.
+   */
+  void readCheckpoint(const std::string &path, bool invalidateChanged) {
+    auto &lg = lg::get();
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+      throw std::runtime_error("Could not open checkpoint " + path);
+    }
+    BinaryReader in(file);
+    if (in.readString() != CheckpointMagic ||
+        in.readInt() != CheckpointVersion) {
+      throw std::runtime_error(path + " is not a checkpoint of this version");
+    }
+    auto checked = [](uint64_t index, size_t size) {
+      if (index >= size) {
+        throw std::runtime_error("Malformed checkpoint");
+      }
+      return index;
+    };
+    size_t numMethods = in.readInt();
+    std::vector<std::vector<N>> methods(numMethods);
+    std::vector<bool> affected(numMethods, false);
+    std::unordered_map<M, size_t> methodIndex;
+    for (size_t i = 0; i < numMethods; ++i) {
+      std::string name = in.readString();
+      uint64_t hash = in.readInt();
+      M m = icfg.getMethod(name);
+      if (!m || methodHash(m) != hash) {
+        if (!invalidateChanged) {
+          throw std::runtime_error("Method " + name +
+                                   " has changed since the checkpoint");
+        }
+        affected[i] = true;
+      } else {
+        methods[i] = icfg.getAllInstructionsOf(m);
+      }
+      if (m) {
+        methodIndex.emplace(m, i);
+      }
+    }
+    // nodes are kept as method and position, as the positions in changed
+    // methods do not denote nodes anymore
+    std::vector<std::pair<uint64_t, uint64_t>> nodes(in.readInt());
+    for (auto &n : nodes) {
+      n.first = checked(in.readInt(), numMethods);
+      n.second = in.readInt();
+      if (!affected[n.first]) {
+        checked(n.second, methods[n.first].size());
+      }
+    }
+    std::vector<std::string> factKeys(in.readInt());
+    for (auto &key : factKeys) {
+      key = in.readString();
+    }
+    std::vector<std::string> functionKeys(in.readInt());
+    for (auto &key : functionKeys) {
+      key = in.readString();
+    }
+    auto readRecords = [&in](auto &records) {
+      records.resize(in.readInt());
+      for (auto &record : records) {
+        for (uint64_t &field : record) {
+          field = in.readInt();
+        }
+      }
+    };
+    std::vector<std::array<uint64_t, 4>> jumpFunctions;
+    std::vector<std::array<uint64_t, 5>> endSummaries;
+    std::vector<std::array<uint64_t, 4>> incomingEdges;
+    std::vector<std::array<uint64_t, 3>> pendingEdges;
+    readRecords(jumpFunctions);
+    readRecords(endSummaries);
+    readRecords(incomingEdges);
+    readRecords(pendingEdges);
+    std::vector<uint64_t> unbalancedReturns(in.readInt());
+    for (uint64_t &n : unbalancedReturns) {
+      n = in.readInt();
+    }
+    if (!in.atEnd()) {
+      throw std::runtime_error("Malformed checkpoint");
+    }
+    auto methodOf = [&](uint64_t n) {
+      return nodes[checked(n, nodes.size())].first;
+    };
+    // the transitive callers of the changed methods, in the saved program as
+    // well as in the current one
+    std::vector<size_t> callees;
+    for (size_t i = 0; i < numMethods; ++i) {
+      if (affected[i]) {
+        callees.push_back(i);
+      }
+    }
+    size_t numChanged = callees.size();
+    if (!callees.empty()) {
+      std::unordered_map<size_t, std::set<size_t>> callers;
+      for (auto &edge : incomingEdges) {
+        callers[methodOf(edge[0])].insert(methodOf(edge[2]));
+      }
+      std::vector<M> currentMethods(numMethods);
+      for (auto &entry : methodIndex) {
+        currentMethods[entry.second] = entry.first;
+      }
+      while (!callees.empty()) {
+        size_t callee = callees.back();
+        callees.pop_back();
+        std::set<size_t> calleeCallers = callers[callee];
+        if (currentMethods[callee]) {
+          for (N callSite : icfg.getCallersOf(currentMethods[callee])) {
+            auto search = methodIndex.find(icfg.getMethodOf(callSite));
+            if (search != methodIndex.end()) {
+              calleeCallers.insert(search->second);
+            }
+          }
+        }
+        for (size_t caller : calleeCallers) {
+          if (!affected[caller]) {
+            affected[caller] = true;
+            callees.push_back(caller);
+          }
+        }
+      }
+      if (followReturnPastSeeds) {
+        // unbalanced returns propagate facts from callees into their
+        // callers, hence, all results are invalidated, see invalidate()
+        BOOST_LOG_SEV(lg, INFO) << "Invalidated all results of checkpoint "
+                                << path;
+        return;
+      }
+    }
+    auto kept = [&](uint64_t n) { return !affected[methodOf(n)]; };
+    auto node = [&](uint64_t n) {
+      auto &position = nodes[n];
+      return methods[position.first][position.second];
+    };
+    // the keys are only decoded for the state that is kept, as the facts of
+    // changed methods may not exist anymore
+    std::unordered_map<uint64_t, D> facts;
+    auto fact = [&](uint64_t d) {
+      auto search = facts.find(checked(d, factKeys.size()));
+      if (search == facts.end()) {
+        search =
+            facts.emplace(d, ideTabulationProblem.KeytoD(factKeys[d])).first;
+      }
+      return search->second;
+    };
+    std::unordered_map<uint64_t, EdgeFunctionRef<V>> functions;
+    auto function = [&](uint64_t f) {
+      auto search = functions.find(checked(f, functionKeys.size()));
+      if (search == functions.end()) {
+        search = functions
+                     .emplace(f, edgeFunctionFactory.intern(
+                                     ideTabulationProblem.KeytoEF(
+                                         functionKeys[f])))
+                     .first;
+      }
+      return search->second;
+    };
+    size_t numJumpFunctions = 0;
+    for (auto &jf : jumpFunctions) {
+      if (kept(jf[1])) {
+        jumpFn->addFunction(fact(jf[0]), node(jf[1]), fact(jf[2]),
+                            function(jf[3]));
+        ++numJumpFunctions;
+      }
+    }
+    {
+      std::lock_guard<std::mutex> lock(summaryMutex);
+      for (auto &summary : endSummaries) {
+        if (kept(summary[0]) && kept(summary[2])) {
+          addEndSummary(node(summary[0]), fact(summary[1]), node(summary[2]),
+                        fact(summary[3]), function(summary[4]));
+        }
+      }
+      for (auto &edge : incomingEdges) {
+        if (kept(edge[0]) && kept(edge[2])) {
+          addIncoming(node(edge[0]), fact(edge[1]), node(edge[2]),
+                      fact(edge[3]));
+        }
+      }
+    }
+    size_t numPendingEdges = 0;
+    for (auto &edge : pendingEdges) {
+      if (kept(edge[1])) {
+        schedule(
+            PathEdge<N, D>(fact(edge[0]), node(edge[1]), fact(edge[2])));
+        ++numPendingEdges;
+      }
+    }
+    for (uint64_t n : unbalancedReturns) {
+      if (kept(n)) {
+        unbalancedRetSites.insert(node(n));
+      }
+    }
+    BOOST_LOG_SEV(lg, INFO) << "Loaded checkpoint " << path << " with "
+                            << numJumpFunctions << " jump functions and "
+                            << numPendingEdges << " pending path edges";
+    if (numChanged > 0) {
+      BOOST_LOG_SEV(lg, INFO)
+          << "Invalidated the results of "
+          << std::count(affected.begin(), affected.end(), true)
+          << " methods, as " << numChanged << " have changed";
+    }
+  }
+
+  /// Returns the hash of the IR of m.
+  uint64_t methodHash(M m) {
+    auto search = methodHashes.find(m);
+    if (search == methodHashes.end()) {
+      search = methodHashes.emplace(m, computeFunctionHash(m)).first;
+    }
+    return search->second;
+  }
+
+  /**
+   * Saves a checkpoint by saveCheckpoint(), but logs the error and keeps
+   * solving if that fails, e.g. as the problem has no keys for its facts. No
+   * further periodic checkpoints are attempted in that case.
+   */
+  void trySaveCheckpoint(const std::string &path) {
+    try {
+      saveCheckpoint(path);
+    } catch (std::runtime_error &e) {
+      auto &lg = lg::get();
+      BOOST_LOG_SEV(lg, ERROR) << "Skipped checkpoint: " << e.what();
+      checkpointFailed = true;
+    }
+  }
+
+  /**
+   * Returns the hash that identifies the end summaries of m across programs,
+   * i.e. the hash of the IR of m and of all its transitive callees, as the
+   * summaries depend on each of them.
+   */
+  uint64_t summaryHash(M m) {
+    auto search = summaryHashes.find(m);
+    if (search != summaryHashes.end()) {
+      return search->second;
+    }
+    std::map<std::string, M> reachable{{icfg.getMethodName(m), m}};
+    std::vector<M> worklist{m};
+    while (!worklist.empty()) {
+      M caller = worklist.back();
+      worklist.pop_back();
+      for (N callSite : icfg.getCallsFromWithin(caller)) {
+        for (M callee : icfg.getCalleesOfCallAt(callSite)) {
+          if (reachable.emplace(icfg.getMethodName(callee), callee).second) {
+            worklist.push_back(callee);
+          }
+        }
+      }
+    }
+    uint64_t hash = 0;
+    for (auto &entry : reachable) {
+      hash = hash * 31 + std::hash<std::string>()(entry.first);
+      hash = hash * 31 + methodHash(entry.second);
+    }
+    summaryHashes.emplace(m, hash);
+    return hash;
+  }
+
+  /// Adds the end summaries of the calling contexts the solver has analyzed
+  /// to the shared store, see setSharedEndSummaries(). If finishedMethods is
+  /// given, only the contexts of these methods are added, whose summaries
+  /// must be complete. Returns the number of contexts that have been added.
+  size_t publishEndSummaries(const std::unordered_set<M> *finishedMethods) {
+    std::unordered_map<uint64_t, std::vector<typename SharedSummaries::Exit>>
+        contexts;
+    std::unordered_map<IdType, bool> isFinished;
+    auto include = [&](uint64_t start) {
+      if (!finishedMethods) {
+        return true;
+      }
+      IdType sP = unpackFirstId(start);
+      auto search = isFinished.find(sP);
+      if (search == isFinished.end()) {
+        search = isFinished
+                     .emplace(sP, finishedMethods->count(icfg.getMethodOf(
+                                      nodeIds->get(sP))) > 0)
+                     .first;
+      }
+      return search->second;
+    };
+    {
+      std::lock_guard<std::mutex> lock(summaryMutex);
+      forEachEndSummary(
+          [&](uint64_t start, uint64_t exit, EdgeFunctionRef<V> f) {
+            if (include(start)) {
+              contexts[start].push_back(typename SharedSummaries::Exit{
+                  nodeIds->get(unpackFirstId(exit)),
+                  factIds->get(unpackSecondId(exit)), f.ptr()});
+            }
+          });
+      // contexts from which no exit is reached have no end summaries
+      for (auto &start : incomingtab) {
+        if (include(start.first)) {
+          contexts[start.first];
+        }
+      }
+    }
+    size_t numPublished = 0;
+    for (auto &context : contexts) {
+      N sP = nodeIds->get(unpackFirstId(context.first));
+      if (initialSeeds.count(sP)) {
+        continue;
+      }
+      if (sharedEndSummaries->add(sP,
+                                  factIds->get(unpackSecondId(context.first)),
+                                  std::move(context.second))) {
+        ++numPublished;
+      }
+    }
+    return numPublished;
+  }
+
+  /**
+   * Publishes the end summaries of the calling contexts of the methods that
+   * are finished in the sense of collectFinishedMethods(), such that other
+   * solvers may apply them while this one is still solving. The summaries of
+   * such a context are complete, as neither the method nor any of its
+   * transitive callees has pending path edges, and new calling contexts of
+   * the callees do not add path edges to the existing contexts.
+   */
+  void publishFinishedMethods() {
+    auto &lg = lg::get();
+    std::unordered_set<M> live = liveMethods();
+    std::unordered_set<M> finished;
+    for (auto it = methodsToPublish.begin(); it != methodsToPublish.end();) {
+      if (live.count(*it)) {
+        ++it;
+        continue;
+      }
+      finished.insert(*it);
+      it = methodsToPublish.erase(it);
+    }
+    if (!finished.empty()) {
+      size_t numPublished = publishEndSummaries(&finished);
+      BOOST_LOG_SEV(lg, DEBUG) << "Published " << numPublished
+                               << " end summaries of " << finished.size()
+                               << " finished methods";
+    }
+  }
+
+  /// Calls F(context, exit, function) for every end summary, including the
+  /// spilled ones, where context and exit are the packed (sP, d1) and
+  /// (eP, d2). summaryMutex must be held.
+  template <typename Fn> void forEachEndSummary(Fn F) {
+    for (auto &start : endsummarytab) {
+      for (auto &exit : start.second) {
+        F(start.first, exit.first, exit.second);
+      }
+    }
+    for (auto &start : coldEndSummaries) {
+      for (size_t i = 0; i < start.second.second; ++i) {
+        const ColdEndSummary &cold =
+            (*coldEndSummaryLog)[start.second.first + i];
+        F(start.first, cold.exit,
+          EdgeFunctionRef<V>::getFromOpaqueValue(cold.function));
+      }
+    }
+  }
+
+  /// Returns the methods that are live, i.e. that have pending path edges
+  /// themselves or in one of their transitive callees.
+  std::unordered_set<M> liveMethods() {
+    std::unordered_set<M> live;
+    std::vector<M> callees;
+    pathEdgeWorkList.forEach([&](PathEdge<N, D> edge) {
+      M m = icfg.getMethodOf(edge.getTarget());
+      if (live.insert(m).second) {
+        callees.push_back(m);
+      }
+    });
+    while (!callees.empty()) {
+      M callee = callees.back();
+      callees.pop_back();
+      for (N callSite : icfg.getCallersOf(callee)) {
+        M caller = icfg.getMethodOf(callSite);
+        if (live.insert(caller).second) {
+          callees.push_back(caller);
+        }
+      }
+    }
+    return live;
+  }
+
+  /**
+   * Drops the jump functions of all methods that are finished, i.e. neither
+   * the method itself nor any of its transitive callees has pending path
+   * edges. The path edges of such a method are never looked up again: its
+   * callees do not produce new end summaries for the existing calling
+   * contexts, and new calling contexts only require the end summaries and
+   * the jump functions at the start points, which are kept.
+   */
+  void collectFinishedMethods() {
+    auto &lg = lg::get();
+    std::unordered_set<M> live = liveMethods();
+    size_t removed = 0;
+    for (auto it = methodsToCollect.begin(); it != methodsToCollect.end();) {
+      if (live.count(*it)) {
+        ++it;
+        continue;
+      }
+      std::set<N> startPoints = icfg.getStartPointsOf(*it);
+      for (N n : icfg.getAllInstructionsOf(*it)) {
+        if (!startPoints.count(n)) {
+          removed += jumpFn->removeFunctionsAt(n);
+        }
+      }
+      it = methodsToCollect.erase(it);
+    }
+    BOOST_LOG_SEV(lg, DEBUG) << "Collected " << removed
+                             << " jump functions of finished methods";
+  }
+
+  /**
+   * Returns the number of threads the path edges are processed on. The
+   * performance counters are not thread-safe, hence, PAMM builds use one.
+   */
+  static unsigned threadsToUse(unsigned configured) {
+#ifdef PERFORMANCE_EVA
+    return 1;
+#else
+    return configured;
+#endif
+  }
+
+  /**
+   * Number of shards the caches, jump functions and interners are partitioned
+   * into when the given number of threads uses them. More shards than threads
+   * are used to keep the contention on each shard low.
+   */
+  static size_t shardsFor(unsigned threads) {
+    return (threads > 1) ? threads * 16 : 1;
+  }
+
+  size_t numShards() const { return shardsFor(numThreads); }
+
+  /**
+   * Returns the position of n in a reverse postorder of the control-flow
+   * graph of its method. The whole method is numbered on first use; nodes
+   * that cannot be reached from its start points come first.
+   */
+  uint32_t getReversePostOrderIndex(N n) {
+    auto search = reversePostOrderIndex.find(n);
+    if (search != reversePostOrderIndex.end()) {
+      return search->second;
+    }
+    struct Frame {
+      N node;
+      std::vector<N> succs;
+      size_t next;
+    };
+    std::vector<N> postOrder;
+    std::unordered_set<N> visited;
+    std::vector<Frame> frames;
+    for (N sP : icfg.getStartPointsOf(icfg.getMethodOf(n))) {
+      if (visited.insert(sP).second) {
+        frames.push_back(Frame{sP, icfg.getSuccsOf(sP), 0});
+      }
+      while (!frames.empty()) {
+        Frame &frame = frames.back();
+        if (frame.next < frame.succs.size()) {
+          N succ = frame.succs[frame.next++];
+          if (visited.insert(succ).second) {
+            frames.push_back(Frame{succ, icfg.getSuccsOf(succ), 0});
+          }
+          continue;
+        }
+        postOrder.push_back(frame.node);
+        frames.pop_back();
+      }
+    }
+    for (size_t i = 0; i < postOrder.size(); ++i) {
+      reversePostOrderIndex[postOrder[i]] = postOrder.size() - 1 - i;
+    }
+    return reversePostOrderIndex.emplace(n, 0).first->second;
+  }
+
+  /**
+   * Returns the rank of the strongly connected component of m in the call
+   * graph, callees have smaller ranks than their callers. The components are
+   * computed by Tarjan's algorithm from m, components that have been ranked
+   * before are kept.
+   */
+  uint32_t getSCCRank(M m) {
+    auto search = sccRank.find(m);
+    if (search != sccRank.end()) {
+      return search->second;
+    }
+    struct Frame {
+      M method;
+      std::vector<M> callees;
+      size_t next;
+    };
+    // the DFS index and low link of each method visited by this run
+    std::unordered_map<M, std::pair<uint32_t, uint32_t>> indexAndLowLink;
+    std::vector<M> stack;
+    std::unordered_set<M> onStack;
+    std::vector<Frame> frames;
+    auto visit = [&](M method) {
+      uint32_t index = indexAndLowLink.size();
+      indexAndLowLink[method] = std::make_pair(index, index);
+      stack.push_back(method);
+      onStack.insert(method);
+      std::vector<M> callees;
+      for (N callSite : icfg.getCallsFromWithin(method)) {
+        for (M callee : icfg.getCalleesOfCallAt(callSite)) {
+          callees.push_back(callee);
+        }
+      }
+      frames.push_back(Frame{method, std::move(callees), 0});
+    };
+    visit(m);
+    while (!frames.empty()) {
+      Frame &frame = frames.back();
+      if (frame.next < frame.callees.size()) {
+        M callee = frame.callees[frame.next++];
+        auto visited = indexAndLowLink.find(callee);
+        if (sccRank.count(callee)) {
+          continue;
+        } else if (visited == indexAndLowLink.end()) {
+          visit(callee);
+        } else if (onStack.count(callee)) {
+          auto &lowLink = indexAndLowLink[frame.method].second;
+          lowLink = std::min(lowLink, visited->second.first);
+        }
+        continue;
+      }
+      M method = frame.method;
+      frames.pop_back();
+      std::pair<uint32_t, uint32_t> link = indexAndLowLink[method];
+      if (link.first == link.second) {
+        // the ranks grow with every component, as sccRank does
+        uint32_t rank = sccRank.size();
+        M member;
+        do {
+          member = stack.back();
+          stack.pop_back();
+          onStack.erase(member);
+          sccRank[member] = rank;
+        } while (member != method);
+      }
+      if (!frames.empty()) {
+        auto &lowLink = indexAndLowLink[frames.back().method].second;
+        lowLink = std::min(lowLink, link.second);
+      }
+    }
+    return sccRank[m];
+  }
+
+  /// Returns the priority of a path edge to the target node according to
+  /// the work list's strategy, smaller priorities are processed first.
+  uint64_t getPathEdgePriority(N target) {
+    uint64_t priority = getReversePostOrderIndex(target);
+    if (pathEdgeWorkList.getStrategy() == WorkListStrategy::CalleeFirst) {
+      priority |= static_cast<uint64_t>(getSCCRank(icfg.getMethodOf(target)))
+                  << 32;
+    }
+    return priority;
+  }
+
+  std::mutex &getPropagateMutex(N target, D targetVal) {
+    size_t h = std::hash<N>()(target) * 31 + std::hash<D>()(targetVal);
+    h ^= h >> 4;
+    h ^= h >> 12;
+    return propagateMutexes[h % propagateMutexes.size()];
+  }
+
+  // should be made a callable at some point
+  void pathEdgeProcessingTask(PathEdge<N, D> edge) {
+    PAMM_FACTORY;
+    auto &lg = lg::get();
+    INC_COUNTER("JumpFn Construction");
+    BOOST_LOG_SEV(lg, DEBUG)
+        << "Process path edge: <"
+        << "D source: " << ideTabulationProblem.DtoString(edge.factAtSource())
         << ", "
         << "N target: " << ideTabulationProblem.NtoString(edge.getTarget())
         << ", "
@@ -640,25 +2488,68 @@ private:
   }
 
   // should be made a callable at some point
-  void valueComputationTask(std::vector<N> values) {
+  void valueComputationTask(const std::vector<N> &values,
+                            std::atomic<size_t> &nextIndex) {
     PAMM_FACTORY;
-    for (N n : values) {
+    // nodes are claimed in chunks to keep the contention on nextIndex low
+    const size_t chunkSize = 64;
+    for (size_t begin = nextIndex.fetch_add(chunkSize); begin < values.size();
+         begin = nextIndex.fetch_add(chunkSize)) {
+      size_t end = std::min(begin + chunkSize, values.size());
+      for (size_t i = begin; i < end; ++i) {
+        computeValuesAt(values[i]);
+      }
+    }
+  }
+
+  /**
+   * Computes the values at a node that is neither a call nor a start point
+   * from the values at the start points of its method. Only the row of n in
+   * valtab is written, such that distinct nodes may be processed
+   * concurrently once the row exists.
+   */
+  void computeValuesAt(N n) {
+    if (isInterior(n)) {
+      auto jumpFunctions = jumpFunctionsAt(n);
       for (N sP : icfg.getStartPointsOf(icfg.getMethodOf(n))) {
-        Table<D, D, std::shared_ptr<EdgeFunction<V>>> lookupByTarget;
-        lookupByTarget = jumpFn->lookupByTarget(n);
-        for (typename Table<D, D, std::shared_ptr<EdgeFunction<V>>>::Cell
-                 sourceValTargetValAndFunction : lookupByTarget.cellSet()) {
-          D dPrime = sourceValTargetValAndFunction.getRowKey();
-          D d = sourceValTargetValAndFunction.getColumnKey();
-          std::shared_ptr<EdgeFunction<V>> fPrime =
-              sourceValTargetValAndFunction.getValue();
-          V targetVal = val(sP, dPrime);
-          setVal(n, d,
-                 ideTabulationProblem.join(val(n, d),
-                                           fPrime->computeTarget(targetVal)));
-          INC_COUNTER("Value Computation");
+        for (auto &sourceAndFacts : jumpFunctions) {
+          V targetVal = val(sP, sourceAndFacts.first);
+          for (auto &fact : sourceAndFacts.second) {
+            setVal(n, fact.first,
+                   ideTabulationProblem.join(
+                       val(n, fact.first),
+                       fact.second->computeTarget(targetVal)));
+            INC_COUNTER("Value Computation");
+          }
         }
       }
+      return;
+    }
+    for (N sP : icfg.getStartPointsOf(icfg.getMethodOf(n))) {
+      for (auto sourceValTargetValAndFunction : jumpFn->lookupByTarget(n)) {
+        D dPrime = sourceValTargetValAndFunction.sourceVal;
+        D d = sourceValTargetValAndFunction.targetVal;
+        EdgeFunctionRef<V> fPrime = sourceValTargetValAndFunction.function;
+        V targetVal = val(sP, dPrime);
+        setVal(n, d,
+               ideTabulationProblem.join(val(n, d),
+                                         fPrime->computeTarget(targetVal)));
+        INC_COUNTER("Value Computation");
+      }
+    }
+  }
+
+  /**
+   * Computes the values at n if they have been deferred by a lazy Phase II.
+   * The values of each node are computed at most once.
+   */
+  void computePendingValuesAt(N n) {
+    if (pendingValueNodes.empty()) {
+      return;
+    }
+    IdType id = nodeIds->getId(n);
+    if (pendingValueNodes.erase(id)) {
+      computeValuesAt(n);
     }
   }
 
@@ -666,33 +2557,165 @@ protected:
   D zeroValue;
   I icfg;
   bool computevalues;
+  bool computeValuesLazily;
+  bool blockwisePropagation;
+  bool sparsePropagation;
+  bool batchFlowFunctions;
   bool autoAddZero;
   bool followReturnPastSeeds;
   bool computePersistedSummaries;
+  unsigned numThreads;
+  size_t jumpFunctionGCInterval;
+  size_t pathEdgesSinceGC = 0;
+  size_t maxInMemoryJumpFunctions;
+  size_t numProcessedPathEdges = 0;
+
+  // state of the demand-driven exploration, see query()
+  bool querySeedsSubmitted = false;
+  bool queryExplorationDone = false;
+  bool queryActive = false;
+  bool queryReached = false;
+  N queryNode{};
+  D queryFact{};
+
+  // scheduling priorities of prioritized work list strategies: the position
+  // of each node in a reverse postorder of its method and the rank of each
+  // method's strongly connected component in a bottom-up order of the call
+  // graph
+  std::unordered_map<N, uint32_t> reversePostOrderIndex;
+  std::unordered_map<M, uint32_t> sccRank;
+
+  // number of times an existing jump function has been refined by a join
+  std::atomic<size_t> numJumpFunctionRejoins{0};
+
+  // state of the budgets and checkpoints of solve(), see isInterrupted()
+  bool solveActive = false;
+  bool checkpointRestored = false;
+  bool checkpointFailed = false;
+  std::atomic<SolverStatus> status{SolverStatus::Unsolved};
+  std::chrono::steady_clock::time_point solveStart;
+  std::atomic<size_t> numPathEdgesInSolve{0};
+  std::atomic<size_t> nextResourceCheck{0};
+  size_t pathEdgesSinceCheckpoint = 0;
+
+  // the number of path edges that had been processed when a path edge of the
+  // method was processed last, for methods whose jump functions are in memory
+  std::unordered_map<M, size_t> lastProcessedAt;
+
+  // methods that have received path edges since their jump functions have
+  // been collected last
+  std::unordered_set<M> methodsToCollect;
+
+  // methods that have received path edges since the end summaries of the
+  // finished methods have been published last, see publishFinishedMethods()
+  std::unordered_set<M> methodsToPublish;
+  size_t pathEdgesSincePublish = 0;
+
+  // dense ids of the nodes and facts, the solver's tables are keyed on them
+  std::shared_ptr<Interner<N>> nodeIds;
+  std::shared_ptr<Interner<D>> factIds;
+  using IdType = typename Interner<N>::IdType;
 
   Table<N, N, std::map<D, std::set<D>>> computedIntraPathEdges;
 
   Table<N, N, std::map<D, std::set<D>>> computedInterPathEdges;
 
-  std::shared_ptr<EdgeFunction<V>> allTop;
+  // owns the jump functions and memoizes their compositions and joins; the
+  // solver refers to them by EdgeFunctionRef, which is never reference counted
+  EdgeFunctionFactory<V> edgeFunctionFactory;
+
+  EdgeFunctionRef<V> allTop;
 
   std::shared_ptr<JumpFunctions<N, D, M, V, I>> jumpFn;
 
+  // path edges that have been propagated, but are yet to be processed
+  PathEdgeWorkList<N, D> pathEdgeWorkList;
+
+  // replaces pathEdgeWorkList if path edges are processed by multiple threads
+  std::unique_ptr<ParallelPathEdgeWorkList<N, D>> parallelPathEdgeWorkList;
+
+  // striped locks that make the update of a jump function in propagate()
+  // atomic
+  std::vector<std::mutex> propagateMutexes;
+
+  // guards endsummarytab and incomingtab
+  std::mutex summaryMutex;
+
+  // guards the recorded path edges and unbalancedRetSites
+  std::mutex recordMutex;
+
+  // (node, fact) pairs whose values changed and need to be propagated further
+  std::deque<std::pair<N, D>> valuePropagationWorkList;
+
   // stores summaries that were queried before they were computed
   // see CC 2010 paper by Naeem, Lhotak and Rodriguez
-  Table<N, D, Table<N, D, std::shared_ptr<EdgeFunction<V>>>> endsummarytab;
+  // (sP, d1) -> (eP, d2) -> f
+  std::unordered_map<
+      uint64_t, std::unordered_map<uint64_t, EdgeFunctionRef<V>>>
+      endsummarytab;
+
+  // an end summary of a spilled context, exit is the packed (eP, d2)
+  struct ColdEndSummary {
+    uint64_t exit;
+    const void *function;
+  };
+
+  // spilled contexts (sP, d1) and the range of their end summaries in
+  // coldEndSummaryLog
+  std::unordered_map<uint64_t, std::pair<size_t, size_t>> coldEndSummaries;
+  std::unique_ptr<MappedLog<ColdEndSummary>> coldEndSummaryLog;
 
   // edges going along calls
   // see CC 2010 paper by Naeem, Lhotak and Rodriguez
-  Table<N, D, std::map<N, std::set<D>>> incomingtab;
+  // (sP, d3) -> n -> {d2}
+  std::unordered_map<uint64_t, std::unordered_map<IdType, std::set<IdType>>>
+      incomingtab;
 
   // stores the return sites (inside callers) to which we have unbalanced
   // returns if followReturnPastSeeds is enabled
   std::set<N> unbalancedRetSites;
 
+  // the end summaries of a method in the persisted form, see
+  // exportSummaries(): nodes are positions in the method, facts and edge
+  // functions are keys of the problem
+  struct PersistedExit {
+    uint64_t exit;
+    std::string fact;
+    std::string function;
+  };
+  struct PersistedMethod {
+    // (position of sP, d1) -> end summaries
+    std::map<std::pair<uint64_t, std::string>, std::vector<PersistedExit>>
+        contexts;
+  };
+
+  // imported end summaries by method name and hash, see importSummaries()
+  std::map<std::pair<std::string, uint64_t>, PersistedMethod>
+      persistedMethods;
+  bool persistedSummariesImported = false;
+
+  // the imported end summaries of the methods that are unchanged, they are
+  // applied at calls instead of analyzing the callees
+  // (sP, d1) -> {(eP, d2, f)}
+  std::unordered_map<
+      uint64_t, std::set<typename Table<N, D, EdgeFunctionRef<V>>::Cell>>
+      importedSummaries;
+
+  // hashes of the IR of each method and of the method and its transitive
+  // callees, see summaryHash()
+  std::unordered_map<M, uint64_t> methodHashes;
+  std::unordered_map<M, uint64_t> summaryHashes;
+
   std::map<N, std::set<D>> initialSeeds;
 
-  Table<N, D, V> valtab;
+  // end summaries shared with other solvers, see setSharedEndSummaries()
+  SharedSummaries *sharedEndSummaries = nullptr;
+
+  // values of the facts, indexed by node id and keyed on fact ids
+  std::vector<std::unordered_map<IdType, V>> valtab;
+
+  // nodes whose values have not been computed yet by a lazy Phase II
+  std::unordered_set<IdType> pendingValueNodes;
 
   // When transforming an IFDSTabulationProblem into an IDETabulationProblem,
   // we need to allocate dynamically, otherwise the objects lifetime runs out -
@@ -705,20 +2728,54 @@ protected:
             std::make_unique<IFDSToIDETabulationProblem<N, D, M, I>>(
                 tabulationProblem)),
         ideTabulationProblem(*transformedProblem),
-        cachedFlowEdgeFunctions(ideTabulationProblem),
+        cachedFlowEdgeFunctions(ideTabulationProblem,
+                                shardsFor(threadsToUse(
+                                    ideTabulationProblem.solver_config
+                                        .numThreads))),
         recordEdges(ideTabulationProblem.solver_config.recordEdges),
         zeroValue(ideTabulationProblem.zeroValue()),
         icfg(ideTabulationProblem.interproceduralCFG()),
         computevalues(ideTabulationProblem.solver_config.computeValues),
+        computeValuesLazily(ideTabulationProblem.solver_config.computeValuesLazily),
+        blockwisePropagation(
+            ideTabulationProblem.solver_config.blockwisePropagation),
+        sparsePropagation(ideTabulationProblem.solver_config.sparsePropagation),
+        batchFlowFunctions(
+            ideTabulationProblem.solver_config.batchFlowFunctions),
         autoAddZero(ideTabulationProblem.solver_config.autoAddZero),
         followReturnPastSeeds(
             ideTabulationProblem.solver_config.followReturnsPastSeeds),
         computePersistedSummaries(
             ideTabulationProblem.solver_config.computePersistedSummaries),
-        allTop(ideTabulationProblem.allTopFunction()),
+        numThreads(
+            threadsToUse(ideTabulationProblem.solver_config.numThreads)),
+        jumpFunctionGCInterval(
+            ideTabulationProblem.solver_config.jumpFunctionGCInterval),
+        maxInMemoryJumpFunctions(
+            ideTabulationProblem.solver_config.maxInMemoryJumpFunctions),
+        nodeIds(std::make_shared<Interner<N>>(numShards())),
+        factIds(std::make_shared<Interner<D>>(numShards())),
+        edgeFunctionFactory(
+            ideTabulationProblem.solver_config.edgeFunctionCacheSize,
+            numShards()),
+        allTop(
+            edgeFunctionFactory.intern(ideTabulationProblem.allTopFunction())),
         jumpFn(std::make_shared<JumpFunctions<N, D, M, V, I>>(
-            allTop, ideTabulationProblem)),
+            allTop, ideTabulationProblem, numShards(), nodeIds, factIds,
+            ideTabulationProblem.solver_config.spillDirectory)),
+        pathEdgeWorkList(ideTabulationProblem.solver_config.workListStrategy),
+        propagateMutexes(numShards()),
         initialSeeds(ideTabulationProblem.initialSeeds()) {
+    if (numThreads < ideTabulationProblem.solver_config.numThreads) {
+      auto &lg = lg::get();
+      BOOST_LOG_SEV(lg, WARNING)
+          << "Processing path edges on one thread, as PAMM is enabled";
+    }
+    if (numThreads > 1) {
+      parallelPathEdgeWorkList =
+          std::make_unique<ParallelPathEdgeWorkList<N, D>>(
+              numThreads, ideTabulationProblem.solver_config.workListStrategy);
+    }
     // std::cout << "called IDESolver::IDESolver() ctor with IFDSProblem" <<
     // std::endl;
   }
@@ -744,21 +2801,50 @@ protected:
       for (D val : seed.second) {
         setVal(startPoint, val, ideTabulationProblem.bottomElement());
         std::pair<N, D> superGraphNode(startPoint, val);
-        valuePropagationTask(superGraphNode);
+        valuePropagationWorkList.push_back(superGraphNode);
       }
     }
+    while (!valuePropagationWorkList.empty()) {
+      std::pair<N, D> nAndD = valuePropagationWorkList.front();
+      valuePropagationWorkList.pop_front();
+      valuePropagationTask(nAndD);
+    }
     // Phase II(ii)
-    // we create an array of all nodes and then dispatch fractions of this array
-    // to multiple threads
     std::set<N> allNonCallStartNodes = icfg.allNonCallStartNodes();
     ADD_TO_HIST("IDESolver", allNonCallStartNodes.size());
+    if (computeValuesLazily) {
+      // the values at the start points are known now, the values of the
+      // remaining nodes are computed once they are asked for
+      pendingValueNodes.clear();
+      for (N n : allNonCallStartNodes) {
+        pendingValueNodes.insert(nodeIds->getOrCreateId(n));
+      }
+      return;
+    }
+    // we create an array of all nodes and then dispatch fractions of this array
+    // to multiple threads
     std::vector<N> nonCallStartNodesArray(allNonCallStartNodes.size());
     size_t i = 0;
     for (N n : allNonCallStartNodes) {
       nonCallStartNodesArray[i] = n;
+      // create the rows up front, the workers must not resize valtab
+      nodeIds->getOrCreateId(n);
       i++;
     }
-    valueComputationTask(nonCallStartNodesArray);
+    if (valtab.size() < nodeIds->size()) {
+      valtab.resize(nodeIds->size());
+    }
+    std::atomic<size_t> nextIndex(0);
+    std::vector<std::thread> workers;
+    for (unsigned t = 1; t < numThreads; ++t) {
+      workers.emplace_back([this, &nonCallStartNodesArray, &nextIndex] {
+        valueComputationTask(nonCallStartNodesArray, nextIndex);
+      });
+    }
+    valueComputationTask(nonCallStartNodesArray, nextIndex);
+    for (auto &worker : workers) {
+      worker.join();
+    }
   }
 
   /**
@@ -768,18 +2854,38 @@ protected:
    */
   void submitInitalSeeds() {
     // std::cout << "IDESolver::submitInitialSeeds()" << std::endl;
+    if (parallelPathEdgeWorkList) {
+      // the worker threads are started once for all seeds
+      for (const auto &seed : initialSeeds) {
+        for (const D &value : seed.second) {
+          propagate(zeroValue, seed.first, value,
+                    edgeFunctionFactory.intern(EdgeIdentity<V>::getInstance()),
+                    nullptr, false);
+        }
+      }
+      processPathEdgeWorkList();
+      for (const auto &seed : initialSeeds) {
+        jumpFn->addFunction(
+            zeroValue, seed.first, zeroValue,
+            edgeFunctionFactory.intern(EdgeIdentity<V>::getInstance()));
+      }
+      return;
+    }
     for (const auto &seed : initialSeeds) {
       N startPoint = seed.first;
       // std::cout << "submitInitialSeeds - Start point:" << std::endl;
-      startPoint->print(llvm::outs());
+      // startPoint->print(llvm::outs());
       for (const D &value : seed.second) {
         // std::cout << "submitInitialSeeds - Value:" << std::endl;
         // value->print(llvm::outs());
-        propagate(zeroValue, startPoint, value, EdgeIdentity<V>::getInstance(),
+        propagate(zeroValue, startPoint, value,
+                  edgeFunctionFactory.intern(EdgeIdentity<V>::getInstance()),
                   nullptr, false);
       }
-      jumpFn->addFunction(zeroValue, startPoint, zeroValue,
-                          EdgeIdentity<V>::getInstance());
+      processPathEdgeWorkList();
+      jumpFn->addFunction(
+          zeroValue, startPoint, zeroValue,
+          edgeFunctionFactory.intern(EdgeIdentity<V>::getInstance()));
     }
   }
 
@@ -800,7 +2906,7 @@ protected:
         << "process exit at target: "
         << ideTabulationProblem.NtoString(edge.getTarget());
     N n = edge.getTarget(); // an exit node; line 21...
-    std::shared_ptr<EdgeFunction<V>> f = jumpFunction(edge);
+    EdgeFunctionRef<V> f;
     M methodThatNeedsSummary = icfg.getMethodOf(n);
     D d1 = edge.factAtSource();
     D d2 = edge.factAtTarget();
@@ -808,17 +2914,27 @@ protected:
     std::set<N> startPointsOf = icfg.getStartPointsOf(methodThatNeedsSummary);
     ADD_TO_HIST("IDESolver", startPointsOf.size());
     std::map<N, std::set<D>> inc;
-    for (N sP : startPointsOf) {
-      // line 21.1 of Naeem/Lhotak/Rodriguez
-      // register end-summary
-      addEndSummary(sP, d1, n, d2, f);
-      for (auto entry : incoming(d1, sP)) {
-        inc[entry.first] = std::set<D>{entry.second};
-        // ADD_TO_HIST("Data-flow facts", inc[entry.first].size());
+    {
+      // registering the end summary and querying the incoming edges must
+      // happen atomically, otherwise a concurrently processed call may neither
+      // see the summary nor be seen as an incoming edge
+      std::lock_guard<std::mutex> lock(summaryMutex);
+      // the jump function is read under the lock, such that a thread that
+      // read an older jump function cannot replace a newer end summary
+      f = jumpFunction(edge);
+      for (N sP : startPointsOf) {
+        // line 21.1 of Naeem/Lhotak/Rodriguez
+        // register end-summary
+        addEndSummary(sP, d1, n, d2, f);
+        for (auto entry : incoming(d1, sP)) {
+          inc[entry.first] = std::set<D>{entry.second};
+          // ADD_TO_HIST("Data-flow facts", inc[entry.first].size());
+        }
       }
+      // dumping the whole tables on every exit is quadratic in their sizes
+      // printEndSummaryTab();
+      // printIncomingTab();
     }
-    printEndSummaryTab();
-    printIncomingTab();
     // for each incoming call edge already processed
     //(see processCall(..))
     for (auto entry : inc) {
@@ -831,12 +2947,24 @@ protected:
             cachedFlowEdgeFunctions.getRetFlowFunction(
                 c, methodThatNeedsSummary, n, retSiteC);
         INC_COUNTER("FF Queries");
+        FFSet<D> callerSideDs(entry.second.begin(), entry.second.end());
         // for each incoming-call value
         for (D d4 : entry.second) {
-          std::set<D> targets =
-              computeReturnFlowFunction(retFunction, d1, d2, c, entry.second);
+          FFSet<D> targets =
+              computeReturnFlowFunction(retFunction, d1, d2, c, callerSideDs);
           ADD_TO_HIST("Data-flow facts", targets.size());
           saveEdges(n, retSiteC, d2, targets, true);
+          // the jump functions coming into the call; they are copied as the
+          // lookup locks their shard, which propagate() may need as well
+          std::vector<std::pair<D, EdgeFunctionRef<V>>> callerFunctions;
+          if (!targets.empty()) {
+            for (auto valAndFunc : jumpFn->reverseLookup(c, d4)) {
+              if (valAndFunc.function != allTop) {
+                callerFunctions.emplace_back(valAndFunc.sourceVal,
+                                             valAndFunc.function);
+              }
+            }
+          }
           // for each target value at the return site
           // line 23
           for (D d5 : targets) {
@@ -851,18 +2979,17 @@ protected:
                     c, icfg.getMethodOf(n), n, d2, retSiteC, d5);
             INC_COUNTER_BY_VAL("EF Queries", 2);
             // compose call function * function * return function
-            std::shared_ptr<EdgeFunction<V>> fPrime =
-                f4->composeWith(f)->composeWith(f5);
+            EdgeFunctionRef<V> fPrime = edgeFunctionFactory.compose(
+                edgeFunctionFactory.compose(edgeFunctionFactory.intern(f4), f),
+                f5);
             // for each jump function coming into the call, propagate to return
             // site using the composed function
-            for (auto valAndFunc : jumpFn->reverseLookup(c, d4)) {
-              std::shared_ptr<EdgeFunction<V>> f3 = valAndFunc.second;
-              if (!f3->equalTo(allTop)) {
-                D d3 = valAndFunc.first;
-                D d5_restoredCtx = restoreContextOnReturnedFact(c, d4, d5);
-                propagate(d3, retSiteC, d5_restoredCtx, f3->composeWith(fPrime),
-                          c, false);
-              }
+            for (auto &valAndFunc : callerFunctions) {
+              EdgeFunctionRef<V> f3 = valAndFunc.second;
+              D d3 = valAndFunc.first;
+              D d5_restoredCtx = restoreContextOnReturnedFact(c, d4, d5);
+              propagate(d3, retSiteC, d5_restoredCtx,
+                        edgeFunctionFactory.compose(f3, fPrime), c, false);
             }
           }
         }
@@ -883,8 +3010,8 @@ protected:
               cachedFlowEdgeFunctions.getRetFlowFunction(
                   c, methodThatNeedsSummary, n, retSiteC);
           INC_COUNTER("FF Queries");
-          std::set<D> targets = computeReturnFlowFunction(
-              retFunction, d1, d2, c, std::set<D>{zeroValue});
+          FFSet<D> targets = computeReturnFlowFunction(
+              retFunction, d1, d2, c, FFSet<D>{zeroValue});
           ADD_TO_HIST("Data-flow facts", targets.size());
           saveEdges(n, retSiteC, d2, targets, true);
           for (D d5 : targets) {
@@ -892,8 +3019,10 @@ protected:
                 cachedFlowEdgeFunctions.getReturnEdgeFunction(
                     c, icfg.getMethodOf(n), n, d2, retSiteC, d5);
             INC_COUNTER("EF Queries");
-            propagteUnbalancedReturnFlow(retSiteC, d5, f->composeWith(f5), c);
+            propagteUnbalancedReturnFlow(
+                retSiteC, d5, edgeFunctionFactory.compose(f, f5), c);
             // register for value processing (2nd IDE phase)
+            std::lock_guard<std::mutex> lock(recordMutex);
             unbalancedRetSites.insert(retSiteC);
           }
         }
@@ -907,14 +3036,14 @@ protected:
             cachedFlowEdgeFunctions.getRetFlowFunction(
                 nullptr, methodThatNeedsSummary, n, nullptr);
         INC_COUNTER("FF Queries");
-        retFunction->computeTargets(d2);
+        retFunction->computeTargetSet(d2);
       }
     }
   }
 
   void
   propagteUnbalancedReturnFlow(N retSiteC, D targetVal,
-                               std::shared_ptr<EdgeFunction<V>> edgeFunction,
+                               EdgeFunctionRef<V> edgeFunction,
                                N relatedCallSite) {
     propagate(zeroValue, retSiteC, targetVal, edgeFunction, relatedCallSite,
               true);
@@ -952,18 +3081,30 @@ protected:
    * @param d2 The abstraction at the current node
    * @return The set of abstractions at the successor node
    */
-  std::set<D>
+  FFSet<D>
   computeNormalFlowFunction(std::shared_ptr<FlowFunction<D>> flowFunction, D d1,
                             D d2) {
-    return flowFunction->computeTargets(d2);
+    return flowFunction->computeTargetSet(d2);
+  }
+
+  /**
+   * Computes the normal flow function for all of the given abstractions at
+   * the current node at once.
+   * @param flowFunction The normal flow function to compute
+   * @param sources The abstractions at the current node
+   * @return The abstractions at the successor node for each of the sources
+   */
+  std::map<D, FFSet<D>> computeNormalFlowFunctionBatch(
+      std::shared_ptr<FlowFunction<D>> flowFunction, const FFSet<D> &sources) {
+    return flowFunction->computeTargetsBatch(sources);
   }
 
   /**
    * TODO: comment
    */
-  std::set<D> computeSummaryFlowFunction(
+  FFSet<D> computeSummaryFlowFunction(
       std::shared_ptr<FlowFunction<D>> SummaryFlowFunction, D d1, D d2) {
-    return SummaryFlowFunction->computeTargets(d2);
+    return SummaryFlowFunction->computeTargetSet(d2);
   }
 
   /**
@@ -973,10 +3114,10 @@ protected:
    * @param d2 The abstraction at the call site
    * @return The set of caller-side abstractions at the callee's start node
    */
-  std::set<D>
+  FFSet<D>
   computeCallFlowFunction(std::shared_ptr<FlowFunction<D>> callFlowFunction,
                           D d1, D d2) {
-    return callFlowFunction->computeTargets(d2);
+    return callFlowFunction->computeTargetSet(d2);
   }
 
   /**
@@ -988,9 +3129,9 @@ protected:
    * @param d2 The abstraction at the call site
    * @return The set of caller-side abstractions at the return site
    */
-  std::set<D> computeCallToReturnFlowFunction(
+  FFSet<D> computeCallToReturnFlowFunction(
       std::shared_ptr<FlowFunction<D>> callToReturnFlowFunction, D d1, D d2) {
-    return callToReturnFlowFunction->computeTargets(d2);
+    return callToReturnFlowFunction->computeTargetSet(d2);
   }
 
   /**
@@ -1003,10 +3144,10 @@ protected:
    * @param callerSideDs The abstractions at the call site
    * @return The set of caller-side abstractions at the return site
    */
-  std::set<D>
+  FFSet<D>
   computeReturnFlowFunction(std::shared_ptr<FlowFunction<D>> retFunction, D d1,
-                            D d2, N callSite, std::set<D> callerSideDs) {
-    return retFunction->computeTargets(d2);
+                            D d2, N callSite, const FFSet<D> &callerSideDs) {
+    return retFunction->computeTargetSet(d2);
   }
 
   /**
@@ -1028,24 +3169,30 @@ protected:
    */
   void
   propagate(D sourceVal, N target, D targetVal,
-            std::shared_ptr<EdgeFunction<V>> f,
+            EdgeFunctionRef<V> f,
             /* deliberately exposed to clients */ N relatedCallSite,
             /* deliberately exposed to clients */ bool isUnbalancedReturn) {
     auto &lg = lg::get();
-    std::shared_ptr<EdgeFunction<V>> jumpFnE = nullptr;
-    std::shared_ptr<EdgeFunction<V>> fPrime;
-    if (!jumpFn->reverseLookup(target, targetVal).empty()) {
-      jumpFnE = jumpFn->reverseLookup(target, targetVal)[sourceVal];
-    }
-    if (jumpFnE == nullptr) {
+    // looking up, joining and updating the jump function must be atomic
+    std::unique_lock<std::mutex> lock(getPropagateMutex(target, targetVal));
+    EdgeFunctionRef<V> jumpFnE =
+        jumpFn->getFunction(sourceVal, target, targetVal);
+    if (!jumpFnE) {
       jumpFnE = allTop; // jump function is initialized to all-top
     }
-    fPrime = jumpFnE->joinWith(f);
-    bool newFunction = !(fPrime->equalTo(jumpFnE));
+    // the jump functions are canonical, hence comparing handles suffices
+    EdgeFunctionRef<V> fPrime = edgeFunctionFactory.join(jumpFnE, f);
+    bool newFunction = fPrime != jumpFnE;
     if (newFunction) {
       jumpFn->addFunction(sourceVal, target, targetVal, fPrime);
-      PathEdge<N, D> edge(sourceVal, target, targetVal);
-      pathEdgeProcessingTask(edge);
+      lock.unlock();
+      if (jumpFnE != allTop) {
+        ++numJumpFunctionRejoins;
+      }
+      if (queryActive && target == queryNode && targetVal == queryFact) {
+        queryReached = true;
+      }
+      schedule(PathEdge<N, D>(sourceVal, target, targetVal));
       if (!ideTabulationProblem.isZeroValue(targetVal)) {
         BOOST_LOG_SEV(lg, DEBUG)
             << "EDGE: <F: " << target->getFunction()->getName().str()
@@ -1056,37 +3203,78 @@ protected:
     }
   }
 
+  /// Pushes a path edge into the work list that is in use.
+  void schedule(PathEdge<N, D> edge) {
+    if (parallelPathEdgeWorkList) {
+      parallelPathEdgeWorkList->push(edge);
+    } else if (pathEdgeWorkList.isPrioritized()) {
+      pathEdgeWorkList.push(edge, getPathEdgePriority(edge.getTarget()));
+    } else {
+      pathEdgeWorkList.push(edge);
+    }
+  }
+
   V joinValueAt(N unit, D fact, V curr, V newVal) {
     return ideTabulationProblem.join(curr, newVal);
   }
 
-  std::set<typename Table<N, D, std::shared_ptr<EdgeFunction<V>>>::Cell>
+  std::set<typename Table<N, D, EdgeFunctionRef<V>>::Cell>
   endSummary(N sP, D d3) {
-    return endsummarytab.get(sP, d3).cellSet();
+    std::set<typename Table<N, D, EdgeFunctionRef<V>>::Cell>
+        result;
+    uint64_t context =
+        packIds(nodeIds->getOrCreateId(sP), factIds->getOrCreateId(d3));
+    restoreEndSummaries(context);
+    auto search = endsummarytab.find(context);
+    if (search != endsummarytab.end()) {
+      for (auto &entry : search->second) {
+        result.insert(
+            typename Table<N, D, EdgeFunctionRef<V>>::Cell(
+                nodeIds->get(unpackFirstId(entry.first)),
+                factIds->get(unpackSecondId(entry.first)), entry.second));
+      }
+    }
+    return result;
   }
 
   std::map<N, std::set<D>> incoming(D d1, N sP) {
-    return incomingtab.get(sP, d1);
+    std::map<N, std::set<D>> result;
+    auto search = incomingtab.find(
+        packIds(nodeIds->getOrCreateId(sP), factIds->getOrCreateId(d1)));
+    if (search != incomingtab.end()) {
+      for (auto &entry : search->second) {
+        std::set<D> &facts = result[nodeIds->get(entry.first)];
+        for (IdType fact : entry.second) {
+          facts.insert(factIds->get(fact));
+        }
+      }
+    }
+    return result;
   }
 
   void addIncoming(N sP, D d3, N n, D d2) {
-    incomingtab.get(sP, d3)[n].insert(d2);
+    incomingtab[packIds(nodeIds->getOrCreateId(sP),
+                        factIds->getOrCreateId(d3))][nodeIds->getOrCreateId(n)]
+        .insert(factIds->getOrCreateId(d2));
   }
 
   void printIncomingTab() {
     auto &lg = lg::get();
     BOOST_LOG_SEV(lg, DEBUG) << "start incomingtab entry";
-    for (auto cell : incomingtab.cellSet()) {
-      BOOST_LOG_SEV(lg, DEBUG)
-          << "sP: " << ideTabulationProblem.NtoString(cell.r);
-      BOOST_LOG_SEV(lg, DEBUG)
-          << "d3: " << ideTabulationProblem.DtoString(cell.c);
-      for (auto entry : cell.v) {
+    for (auto &cell : incomingtab) {
+      BOOST_LOG_SEV(lg, DEBUG) << "sP: "
+                               << ideTabulationProblem.NtoString(
+                                      nodeIds->get(unpackFirstId(cell.first)));
+      BOOST_LOG_SEV(lg, DEBUG) << "d3: "
+                               << ideTabulationProblem.DtoString(
+                                      factIds->get(unpackSecondId(cell.first)));
+      for (auto &entry : cell.second) {
         BOOST_LOG_SEV(lg, DEBUG)
-            << "n: " << ideTabulationProblem.NtoString(entry.first);
+            << "n: " << ideTabulationProblem.NtoString(
+                            nodeIds->get(entry.first));
         for (auto fact : entry.second) {
           BOOST_LOG_SEV(lg, DEBUG)
-              << "d2: " << ideTabulationProblem.DtoString(fact);
+              << "d2: " << ideTabulationProblem.DtoString(factIds->get(fact));
         }
       }
       BOOST_LOG_SEV(lg, DEBUG) << "-----";
@@ -1097,17 +3285,22 @@ protected:
   void printEndSummaryTab() {
     auto &lg = lg::get();
     BOOST_LOG_SEV(lg, DEBUG) << "start endsummarytab entry";
-    for (auto cell : endsummarytab.cellVec()) {
-      BOOST_LOG_SEV(lg, DEBUG)
-          << "sP: " << ideTabulationProblem.NtoString(cell.r);
-      BOOST_LOG_SEV(lg, DEBUG)
-          << "d1: " << ideTabulationProblem.DtoString(cell.c);
-      for (auto inner_cell : cell.v.cellVec()) {
+    for (auto &cell : endsummarytab) {
+      BOOST_LOG_SEV(lg, DEBUG) << "sP: "
+                               << ideTabulationProblem.NtoString(
+                                      nodeIds->get(unpackFirstId(cell.first)));
+      BOOST_LOG_SEV(lg, DEBUG) << "d1: "
+                               << ideTabulationProblem.DtoString(
+                                      factIds->get(unpackSecondId(cell.first)));
+      for (auto &inner_cell : cell.second) {
+        BOOST_LOG_SEV(lg, DEBUG)
+            << "eP: " << ideTabulationProblem.NtoString(
+                             nodeIds->get(unpackFirstId(inner_cell.first)));
         BOOST_LOG_SEV(lg, DEBUG)
-            << "eP: " << ideTabulationProblem.NtoString(inner_cell.r);
+            << "d2: " << ideTabulationProblem.DtoString(
+                             factIds->get(unpackSecondId(inner_cell.first)));
         BOOST_LOG_SEV(lg, DEBUG)
-            << "d2: " << ideTabulationProblem.DtoString(inner_cell.c);
-        BOOST_LOG_SEV(lg, DEBUG) << "edge fun: " << inner_cell.v->toString();
+            << "edge fun: " << inner_cell.second->toString();
       }
       BOOST_LOG_SEV(lg, DEBUG) << "-----";
     }
@@ -22,6 +22,8 @@
 #include <phasar/PhasarLLVM/IfdsIde/Solver/IDESolver.h>
 #include <phasar/PhasarLLVM/Utils/BinaryDomain.h>
 #include <set>
+#include <stdexcept>
+#include <string>
 #include <type_traits>
 #include <utility>
 
@@ -82,6 +84,8 @@ public:
 
   bool isZeroValue(D d) const override { return problem.isZeroValue(d); }
 
+  bool mayAffect(N curr, D d) override { return problem.mayAffect(curr, d); }
+
   BinaryDomain topElement() override { return BinaryDomain::TOP; }
 
   BinaryDomain bottomElement() override { return BinaryDomain::BOTTOM; }
@@ -141,6 +145,40 @@ public:
 
   std::string DtoString(D d) const override { return problem.DtoString(d); }
 
+  std::string DtoKey(D d) const override { return problem.DtoKey(d); }
+
+  D KeytoD(const std::string &key) override { return problem.KeytoD(key); }
+
+  // the edge functions of IFDS problems are all-top, the identity and
+  // all-bottom, as are their compositions and joins
+  std::string
+  EFtoKey(std::shared_ptr<EdgeFunction<BinaryDomain>> f) const override {
+    if (dynamic_cast<AllBottom<BinaryDomain> *>(f.get())) {
+      return "bottom";
+    }
+    if (dynamic_cast<AllTop<BinaryDomain> *>(f.get())) {
+      return "top";
+    }
+    if (dynamic_cast<EdgeIdentity<BinaryDomain> *>(f.get())) {
+      return "id";
+    }
+    throw std::runtime_error("Unexpected IFDS edge function " + f->toString());
+  }
+
+  std::shared_ptr<EdgeFunction<BinaryDomain>>
+  KeytoEF(const std::string &key) override {
+    if (key == "bottom") {
+      return ALL_BOTTOM;
+    }
+    if (key == "top") {
+      return allTopFunction();
+    }
+    if (key == "id") {
+      return EdgeIdentity<BinaryDomain>::getInstance();
+    }
+    throw std::runtime_error("Unexpected IFDS edge function key " + key);
+  }
+
   std::string VtoString(BinaryDomain v) const override {
     std::ostringstream osst;
     osst << v;
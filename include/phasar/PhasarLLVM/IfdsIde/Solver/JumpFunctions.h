@@ -17,12 +17,24 @@
 #ifndef ANALYSIS_IFDS_IDE_SOLVER_JUMPFUNCTIONS_H_
 #define ANALYSIS_IFDS_IDE_SOLVER_JUMPFUNCTIONS_H_
 
-#include <map>
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
 #include <memory>
+#include <mutex>
 #include <phasar/PhasarLLVM/IfdsIde/EdgeFunction.h>
+#include <phasar/PhasarLLVM/IfdsIde/EdgeFunctionFactory.h>
+#include <phasar/Utils/FlatHashMap.h>
+#include <phasar/Utils/Interner.h>
 #include <phasar/Utils/LLVMShorthands.h>
 #include <phasar/Utils/Logger.h>
-#include <phasar/Utils/Table.h>
+#include <phasar/Utils/MappedLog.h>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace psr {
 
@@ -31,37 +43,379 @@ namespace psr {
 template <typename N, typename D, typename M, typename V, typename I>
 class IDETabulationProblem;
 
+/**
+ * Stores the jump functions computed by the IDESolver. The jump functions are
+ * canonical edge functions of the solver's EdgeFunctionFactory and are stored
+ * and handed out as EdgeFunctionRef, which does not touch their reference
+ * counts.
+ *
+ * Every jump function is stored exactly once, as a flat record. The records
+ * that share a target node and target value, a target node and source value,
+ * or just a target node are linked into chains, which the lookups walk
+ * without copying. A lookup returns a FunctionRange that keeps the shard of
+ * its target node locked while it exists.
+ *
+ * The jump functions of a target node may be evicted from memory into a
+ * memory-mapped log, see evictFunctionsAt(). Lookups read evicted jump
+ * functions from the log directly, adding a jump function to an evicted
+ * target node loads all of its jump functions back into memory.
+ */
 template <typename N, typename D, typename M, typename L, typename I>
 class JumpFunctions {
 private:
-  std::shared_ptr<EdgeFunction<L>> allTop;
+  EdgeFunctionRef<L> allTop;
   const IDETabulationProblem<N, D, M, L, I> &problem;
 
 protected:
-  // mapping from target node and value to a list of all source values and
-  // associated functions
-  // where the list is implemented as a mapping from the source value to the
-  // function
-  // we exclude empty default functions
-  Table<N, D, std::map<D, std::shared_ptr<EdgeFunction<L>>>>
-      nonEmptyReverseLookup;
-  // mapping from source value and target node to a list of all target values
-  // and associated functions
-  // where the list is implemented as a mapping from the source value to the
-  // function
-  // we exclude empty default functions
-  Table<D, N, std::map<D, std::shared_ptr<EdgeFunction<L>>>>
-      nonEmptyForwardLookup;
-  // a mapping from target node to a list of triples consisting of source value,
-  // target value and associated function; the triple is implemented by a table
-  // we exclude empty default functions
-  std::unordered_map<N, Table<D, D, std::shared_ptr<EdgeFunction<L>>>>
-      nonEmptyLookupByTargetNode;
+  using IdType = typename Interner<N>::IdType;
+  static constexpr IdType NoRecord = Interner<N>::InvalidId;
+
+  // the chains that link the records of a shard
+  enum Chain { ByTargetVal = 0, BySourceVal, ByTarget, NumChains };
+
+  // a jump function of an evicted target node
+  struct ColdJumpFunction {
+    IdType sourceVal;
+    IdType targetVal;
+    const void *function;
+  };
+
+  // A jump function; the links refer to the neighbouring records of each
+  // chain, freed records are chained through next[0].
+  struct Record {
+    IdType target;
+    IdType sourceVal;
+    IdType targetVal;
+    IdType next[NumChains];
+    IdType prev[NumChains];
+    const void *function;
+  };
+
+  struct RecordKey {
+    uint64_t targetAndSourceVal;
+    IdType targetVal;
+    bool operator==(const RecordKey &other) const {
+      return targetAndSourceVal == other.targetAndSourceVal &&
+             targetVal == other.targetVal;
+    }
+  };
+
+  struct RecordKeyHash {
+    size_t operator()(const RecordKey &key) const {
+      return key.targetAndSourceVal ^
+             (static_cast<uint64_t>(key.targetVal) * 0xC2B2AE3D27D4EB4Full);
+    }
+  };
+
+  // Nodes and facts are stored as dense ids; pairs of them are packed into
+  // 64-bit keys. The interners are shared with the solver.
+  std::shared_ptr<Interner<N>> nodeIds;
+  std::shared_ptr<Interner<D>> factIds;
+
+  // The jump functions are partitioned into shards according to their target
+  // node. Each shard is guarded by its own mutex, such that jump functions
+  // with different targets can be accessed concurrently.
+  struct Shard {
+    std::mutex Mutex;
+    std::vector<Record> records;
+    IdType freeRecords = NoRecord;
+    // the record of each (target node, source value, target value)
+    FlatHashMap<RecordKey, IdType, RecordKeyHash> recordOf;
+    // the first record of each chain, see chainKey()
+    FlatHashMap<uint64_t, IdType> heads[NumChains];
+    // evicted target nodes and the range of their jump functions in coldLog
+    std::unordered_map<IdType, std::pair<size_t, size_t>> coldTargets;
+  };
+  std::vector<std::unique_ptr<Shard>> shards;
+
+  // number of jump functions held in memory
+  std::atomic<size_t> numInMemory;
+
+  std::string spillDirectory;
+  std::mutex coldLogMutex;
+  std::unique_ptr<MappedLog<ColdJumpFunction>> coldLog;
+
+  Shard &getShard(IdType targetId) { return *shards[targetId % shards.size()]; }
+
+  static uint64_t chainKey(const Record &record, Chain chain) {
+    switch (chain) {
+    case ByTargetVal:
+      return packIds(record.target, record.targetVal);
+    case BySourceVal:
+      return packIds(record.target, record.sourceVal);
+    default:
+      return record.target;
+    }
+  }
+
+  /// Records a jump function, returns false if it only replaced the function
+  /// of an existing record. The shard must be locked.
+  bool insertRecord(Shard &shard, IdType targetId, IdType sourceId,
+                    IdType targetValId, EdgeFunctionRef<L> function) {
+    auto slot = shard.recordOf.insert(
+        RecordKey{packIds(targetId, sourceId), targetValId}, NoRecord);
+    if (!slot.second) {
+      shard.records[*slot.first].function = function.getOpaqueValue();
+      return false;
+    }
+    IdType id = shard.freeRecords;
+    if (id != NoRecord) {
+      shard.freeRecords = shard.records[id].next[0];
+    } else {
+      id = shard.records.size();
+      shard.records.emplace_back();
+    }
+    *slot.first = id;
+    Record &record = shard.records[id];
+    record.target = targetId;
+    record.sourceVal = sourceId;
+    record.targetVal = targetValId;
+    record.function = function.getOpaqueValue();
+    for (int chain = 0; chain < NumChains; ++chain) {
+      auto head = shard.heads[chain].insert(
+          chainKey(record, static_cast<Chain>(chain)), id);
+      record.prev[chain] = NoRecord;
+      record.next[chain] = head.second ? NoRecord : *head.first;
+      if (!head.second) {
+        shard.records[*head.first].prev[chain] = id;
+        *head.first = id;
+      }
+    }
+    ++numInMemory;
+    return true;
+  }
+
+  /// Unlinks a record from its chains and frees it. The shard must be locked.
+  void eraseRecord(Shard &shard, IdType id) {
+    Record &record = shard.records[id];
+    for (int chain = 0; chain < NumChains; ++chain) {
+      IdType prev = record.prev[chain];
+      IdType next = record.next[chain];
+      if (prev != NoRecord) {
+        shard.records[prev].next[chain] = next;
+      } else {
+        uint64_t key = chainKey(record, static_cast<Chain>(chain));
+        if (next != NoRecord) {
+          *shard.heads[chain].find(key) = next;
+        } else {
+          shard.heads[chain].erase(key);
+        }
+      }
+      if (next != NoRecord) {
+        shard.records[next].prev[chain] = prev;
+      }
+    }
+    shard.recordOf.erase(RecordKey{
+        packIds(record.target, record.sourceVal), record.targetVal});
+    record.next[0] = shard.freeRecords;
+    shard.freeRecords = id;
+    --numInMemory;
+  }
+
+  /// Removes all records of the target node from memory and calls F on each
+  /// of them beforehand. The shard must be locked.
+  template <typename Fn>
+  size_t eraseRecordsAt(Shard &shard, IdType targetId, Fn F) {
+    IdType *head = shard.heads[ByTarget].find(targetId);
+    if (!head) {
+      return 0;
+    }
+    size_t erased = 0;
+    for (IdType id = *head; id != NoRecord;) {
+      IdType next = shard.records[id].next[ByTarget];
+      F(shard.records[id]);
+      eraseRecord(shard, id);
+      ++erased;
+      id = next;
+    }
+    return erased;
+  }
+
+  /// Loads the jump functions of an evicted target node back into memory.
+  /// The shard must be locked.
+  void restore(Shard &shard, IdType targetId) {
+    if (shard.coldTargets.empty()) {
+      return;
+    }
+    auto search = shard.coldTargets.find(targetId);
+    if (search == shard.coldTargets.end()) {
+      return;
+    }
+    std::vector<ColdJumpFunction> cold;
+    {
+      std::lock_guard<std::mutex> lock(coldLogMutex);
+      const ColdJumpFunction *begin = coldLog->data(search->second.first);
+      cold.assign(begin, begin + search->second.second);
+    }
+    shard.coldTargets.erase(search);
+    for (const ColdJumpFunction &function : cold) {
+      insertRecord(shard, targetId, function.sourceVal, function.targetVal,
+                   EdgeFunctionRef<L>::getFromOpaqueValue(function.function));
+    }
+  }
+
+public:
+  /**
+   * The jump functions returned by a lookup. The range is read directly from
+   * the storage, it keeps the shard of its target node locked while it
+   * exists. Hence, no jump functions may be added, removed or looked up at a
+   * target node of the same shard by the thread that holds the range; callers
+   * that propagate while iterating must copy the range first.
+   */
+  class FunctionRange {
+  public:
+    struct Entry {
+      D sourceVal;
+      D targetVal;
+      EdgeFunctionRef<L> function;
+    };
+
+    class iterator {
+    private:
+      const FunctionRange *range;
+      IdType current;
+      size_t coldIndex;
+
+      // skips the evicted jump functions that do not belong to the range
+      void settle() {
+        while (coldIndex < range->coldEnd &&
+               !range->matches(range->cold[coldIndex])) {
+          ++coldIndex;
+        }
+      }
+
+    public:
+      using iterator_category = std::input_iterator_tag;
+      using value_type = Entry;
+      using difference_type = std::ptrdiff_t;
+      using pointer = const Entry *;
+      using reference = Entry;
+
+      iterator(const FunctionRange *range, IdType current, size_t coldIndex)
+          : range(range), current(current), coldIndex(coldIndex) {
+        settle();
+      }
+
+      Entry operator*() const {
+        const Interner<D> &facts = *range->factIds;
+        if (current != NoRecord) {
+          const Record &record = range->records[current];
+          return Entry{
+              facts.get(record.sourceVal), facts.get(record.targetVal),
+              EdgeFunctionRef<L>::getFromOpaqueValue(record.function)};
+        }
+        const ColdJumpFunction &cold = range->cold[coldIndex];
+        return Entry{facts.get(cold.sourceVal), facts.get(cold.targetVal),
+                     EdgeFunctionRef<L>::getFromOpaqueValue(cold.function)};
+      }
+
+      iterator &operator++() {
+        if (current != NoRecord) {
+          current = range->records[current].next[range->chain];
+        } else {
+          ++coldIndex;
+          settle();
+        }
+        return *this;
+      }
+
+      iterator operator++(int) {
+        iterator old = *this;
+        ++*this;
+        return old;
+      }
+
+      bool operator==(const iterator &other) const {
+        return current == other.current && coldIndex == other.coldIndex;
+      }
+
+      bool operator!=(const iterator &other) const { return !(*this == other); }
+    };
+
+  private:
+    friend class JumpFunctions;
+    std::unique_lock<std::mutex> shardLock;
+    std::unique_lock<std::mutex> coldLock;
+    const Interner<D> *factIds = nullptr;
+    // the chain of in-memory records
+    const Record *records = nullptr;
+    Chain chain = ByTarget;
+    IdType head = NoRecord;
+    // the evicted jump functions of the target node
+    const ColdJumpFunction *cold = nullptr;
+    size_t coldEnd = 0;
+    IdType filter = NoRecord;
+
+    bool matches(const ColdJumpFunction &function) const {
+      switch (chain) {
+      case ByTargetVal:
+        return function.targetVal == filter;
+      case BySourceVal:
+        return function.sourceVal == filter;
+      default:
+        return true;
+      }
+    }
+
+  public:
+    FunctionRange() = default;
+    FunctionRange(FunctionRange &&) = default;
+    FunctionRange &operator=(FunctionRange &&) = default;
+
+    iterator begin() const { return iterator(this, head, 0); }
+
+    iterator end() const { return iterator(this, NoRecord, coldEnd); }
+
+    bool empty() const { return begin() == end(); }
+  };
+
+protected:
+  /**
+   * Returns the jump functions at the target node that lie on the given
+   * chain; filter is the target or source value that selects the chain.
+   */
+  FunctionRange lookup(IdType targetId, Chain chain, IdType filter) {
+    FunctionRange range;
+    range.factIds = factIds.get();
+    range.chain = chain;
+    range.filter = filter;
+    if (targetId == Interner<N>::InvalidId ||
+        (chain != ByTarget && filter == Interner<D>::InvalidId)) {
+      return range;
+    }
+    Shard &shard = getShard(targetId);
+    range.shardLock = std::unique_lock<std::mutex>(shard.Mutex);
+    auto cold = shard.coldTargets.find(targetId);
+    if (cold != shard.coldTargets.end()) {
+      range.coldLock = std::unique_lock<std::mutex>(coldLogMutex);
+      range.cold = coldLog->data(cold->second.first);
+      range.coldEnd = cold->second.second;
+      return range;
+    }
+    uint64_t key =
+        (chain == ByTarget) ? targetId : packIds(targetId, filter);
+    if (const IdType *head = shard.heads[chain].find(key)) {
+      range.records = shard.records.data();
+      range.head = *head;
+    }
+    return range;
+  }
 
 public:
-  JumpFunctions(std::shared_ptr<EdgeFunction<L>> allTop,
-                const IDETabulationProblem<N, D, M, L, I> &p)
-      : allTop(allTop), problem(p) {}
+  JumpFunctions(EdgeFunctionRef<L> allTop,
+                const IDETabulationProblem<N, D, M, L, I> &p,
+                size_t numShards = 1,
+                std::shared_ptr<Interner<N>> nodeIds = nullptr,
+                std::shared_ptr<Interner<D>> factIds = nullptr,
+                std::string spillDirectory = "")
+      : allTop(allTop), problem(p),
+        nodeIds(nodeIds ? nodeIds : std::make_shared<Interner<N>>(numShards)),
+        factIds(factIds ? factIds : std::make_shared<Interner<D>>(numShards)),
+        numInMemory(0), spillDirectory(spillDirectory) {
+    for (size_t i = 0; i < std::max<size_t>(numShards, 1); ++i) {
+      shards.push_back(std::make_unique<Shard>());
+    }
+  }
 
   virtual ~JumpFunctions() = default;
 
@@ -70,7 +424,7 @@ public:
    * @see PathEdge
    */
   void addFunction(D sourceVal, N target, D targetVal,
-                   std::shared_ptr<EdgeFunction<L>> function) {
+                   EdgeFunctionRef<L> function) {
     auto &lg = lg::get();
     BOOST_LOG_SEV(lg, DEBUG) << "Start adding new jump function";
     BOOST_LOG_SEV(lg, DEBUG)
@@ -80,58 +434,125 @@ public:
     BOOST_LOG_SEV(lg, DEBUG) << "Destination: " << problem.NtoString(target);
     BOOST_LOG_SEV(lg, DEBUG) << "EdgeFunction: " << function->toString();
     // we do not store the default function (all-top)
-    if (function->equalTo(allTop))
+    if (function == allTop)
       return;
-    std::map<D, std::shared_ptr<EdgeFunction<L>>> &sourceValToFunc =
-        nonEmptyReverseLookup.get(target, targetVal);
-    sourceValToFunc.insert({sourceVal, function});
-    //	printNonEmptyReverseLookup();
-    std::map<D, std::shared_ptr<EdgeFunction<L>>> &targetValToFunc =
-        nonEmptyForwardLookup.get(sourceVal, target);
-    targetValToFunc.insert({targetVal, function});
-    //	printNonEmptyForwardLookup();
-    nonEmptyLookupByTargetNode[target].insert(sourceVal, targetVal, function);
-    //	printNonEmptyLookupByTargetNode();
+    IdType sourceId = factIds->getOrCreateId(sourceVal);
+    IdType targetId = nodeIds->getOrCreateId(target);
+    IdType targetValId = factIds->getOrCreateId(targetVal);
+    Shard &shard = getShard(targetId);
+    std::lock_guard<std::mutex> lock(shard.Mutex);
+    restore(shard, targetId);
+    insertRecord(shard, targetId, sourceId, targetValId, function);
     BOOST_LOG_SEV(lg, DEBUG) << "End adding new jump function";
   }
 
   /**
    * Returns, for a given target statement and value all associated
    * source values, and for each the associated edge function.
-   * The return value is a mapping from source value to function.
+   * The entries of the returned range carry the source value and function.
    */
-  std::map<D, std::shared_ptr<EdgeFunction<L>>> reverseLookup(N target,
-                                                              D targetVal) {
-    if (!nonEmptyReverseLookup.contains(target, targetVal))
-      return std::map<D, std::shared_ptr<EdgeFunction<L>>>{};
-    else
-      return nonEmptyReverseLookup.get(target, targetVal);
+  FunctionRange reverseLookup(N target, D targetVal) {
+    return lookup(nodeIds->getId(target), ByTargetVal,
+                  factIds->getId(targetVal));
   }
 
   /**
    * Returns, for a given source value and target statement all
    * associated target values, and for each the associated edge function.
-   * The return value is a mapping from target value to function.
+   * The entries of the returned range carry the target value and function.
    */
-  std::map<D, std::shared_ptr<EdgeFunction<L>>> forwardLookup(D sourceVal,
-                                                              N target) {
-    if (!nonEmptyForwardLookup.contains(sourceVal, target))
-      return std::map<D, std::shared_ptr<EdgeFunction<L>>>{};
-    else
-      return nonEmptyForwardLookup.get(sourceVal, target);
+  FunctionRange forwardLookup(D sourceVal, N target) {
+    return lookup(nodeIds->getId(target), BySourceVal,
+                  factIds->getId(sourceVal));
   }
 
   /**
    * Returns for a given target statement all jump function records with this
    * target.
-   * The return value is a set of records of the form
+   * The entries of the returned range are of the form
    * (sourceVal,targetVal,edgeFunction).
    */
-  Table<D, D, std::shared_ptr<EdgeFunction<L>>> lookupByTarget(N target) {
-    // if (nonEmptyLookupByTargetNode.count(target))
-    //	return Table<D, D, std::shared_ptr<EdgeFunction<L>>>{};
-    // else
-    return nonEmptyLookupByTargetNode[target];
+  FunctionRange lookupByTarget(N target) {
+    return lookup(nodeIds->getId(target), ByTarget, NoRecord);
+  }
+
+  /**
+   * Returns the jump function from sourceVal to targetVal at the target
+   * statement, or a null reference if there is none.
+   */
+  EdgeFunctionRef<L> getFunction(D sourceVal, N target, D targetVal) {
+    IdType sourceId = factIds->getId(sourceVal);
+    IdType targetId = nodeIds->getId(target);
+    IdType targetValId = factIds->getId(targetVal);
+    if (sourceId == Interner<D>::InvalidId ||
+        targetId == Interner<N>::InvalidId ||
+        targetValId == Interner<D>::InvalidId)
+      return EdgeFunctionRef<L>();
+    Shard &shard = getShard(targetId);
+    std::lock_guard<std::mutex> lock(shard.Mutex);
+    if (!shard.coldTargets.empty()) {
+      auto cold = shard.coldTargets.find(targetId);
+      if (cold != shard.coldTargets.end()) {
+        std::lock_guard<std::mutex> logLock(coldLogMutex);
+        for (size_t i = 0; i < cold->second.second; ++i) {
+          const ColdJumpFunction &function = (*coldLog)[cold->second.first + i];
+          if (function.sourceVal == sourceId &&
+              function.targetVal == targetValId)
+            return EdgeFunctionRef<L>::getFromOpaqueValue(function.function);
+        }
+        return EdgeFunctionRef<L>();
+      }
+    }
+    const IdType *id =
+        shard.recordOf.find(RecordKey{packIds(targetId, sourceId), targetValId});
+    if (!id)
+      return EdgeFunctionRef<L>();
+    return EdgeFunctionRef<L>::getFromOpaqueValue(shard.records[*id].function);
+  }
+
+  /**
+   * Moves all jump functions whose target is the given statement from memory
+   * to the memory-mapped log.
+   * @return The number of jump functions that have been evicted.
+   */
+  size_t evictFunctionsAt(N target) {
+    IdType targetId = nodeIds->getId(target);
+    if (targetId == Interner<N>::InvalidId)
+      return 0;
+    Shard &shard = getShard(targetId);
+    std::lock_guard<std::mutex> lock(shard.Mutex);
+    std::vector<ColdJumpFunction> cold;
+    eraseRecordsAt(shard, targetId, [&](const Record &record) {
+      cold.push_back({record.sourceVal, record.targetVal, record.function});
+    });
+    if (cold.empty())
+      return 0;
+    std::lock_guard<std::mutex> logLock(coldLogMutex);
+    if (!coldLog) {
+      coldLog = std::make_unique<MappedLog<ColdJumpFunction>>(spillDirectory);
+    }
+    shard.coldTargets[targetId] =
+        std::make_pair(coldLog->append(cold.data(), cold.size()), cold.size());
+    return cold.size();
+  }
+
+  /// Returns the number of jump functions held in memory.
+  size_t numInMemoryFunctions() const { return numInMemory; }
+
+  /// Returns all target statements that have jump functions, including those
+  /// whose jump functions have been evicted.
+  std::vector<N> getTargets() {
+    std::vector<N> targets;
+    for (auto &shard : shards) {
+      std::lock_guard<std::mutex> lock(shard->Mutex);
+      shard->heads[ByTarget].forEach([&](uint64_t target, IdType) {
+        targets.push_back(nodeIds->get(target));
+      });
+      for (auto &cold : shard->coldTargets) {
+        targets.push_back(nodeIds->get(cold.first));
+      }
+    }
+    return targets;
   }
 
   /**
@@ -141,110 +562,147 @@ public:
    * there anyway.
    */
   bool removeFunction(D sourceVal, N target, D targetVal) {
-    //			Map<D,EdgeFunction<L>> sourceValToFunc =
-    // nonEmptyReverseLookup.get(target, targetVal);
-    //			if (sourceValToFunc == null)
-    //				return false;
-    //			if (sourceValToFunc.remove(sourceVal) == null)
-    //				return false;
-    //			if (sourceValToFunc.empty())
-    //				nonEmptyReverseLookup.remove(targetVal,
-    // targetVal);
-    //
-    //			Map<D, EdgeFunction<L>> targetValToFunc =
-    // nonEmptyForwardLookup.get(sourceVal, target);
-    //			if (targetValToFunc == null)
-    //				return false;
-    //			if (targetValToFunc.remove(targetVal) == null)
-    //				return false;
-    //			if (targetValToFunc.empty())
-    //				nonEmptyForwardLookup.remove(sourceVal, target);
-    //
-    //			Table<D,D,EdgeFunction<L>> table =
-    // nonEmptyLookupByTargetNode.get(target);
-    //			if (table == null)
-    //				return false;
-    //			if (table.remove(sourceVal, targetVal) == null)
-    //				return false;
-    //			if (table.empty())
-    //				nonEmptyLookupByTargetNode.remove(target);
-    //
-    //			return true;
-    return false;
+    IdType sourceId = factIds->getId(sourceVal);
+    IdType targetId = nodeIds->getId(target);
+    IdType targetValId = factIds->getId(targetVal);
+    if (sourceId == Interner<D>::InvalidId ||
+        targetId == Interner<N>::InvalidId ||
+        targetValId == Interner<D>::InvalidId)
+      return false;
+    Shard &shard = getShard(targetId);
+    std::lock_guard<std::mutex> lock(shard.Mutex);
+    restore(shard, targetId);
+    const IdType *id =
+        shard.recordOf.find(RecordKey{packIds(targetId, sourceId), targetValId});
+    if (!id)
+      return false;
+    eraseRecord(shard, *id);
+    return true;
+  }
+
+  /**
+   * Removes all jump functions whose target is the given statement.
+   * @return The number of jump functions that have been removed.
+   */
+  size_t removeFunctionsAt(N target) {
+    IdType targetId = nodeIds->getId(target);
+    if (targetId == Interner<N>::InvalidId)
+      return 0;
+    Shard &shard = getShard(targetId);
+    std::lock_guard<std::mutex> lock(shard.Mutex);
+    auto cold = shard.coldTargets.find(targetId);
+    if (cold != shard.coldTargets.end()) {
+      size_t removed = cold->second.second;
+      shard.coldTargets.erase(cold);
+      return removed;
+    }
+    return eraseRecordsAt(shard, targetId, [](const Record &) {});
   }
 
   /**
    * Removes all jump functions
    */
   void clear() {
-    nonEmptyReverseLookup.clear();
-    nonEmptyForwardLookup.clear();
-    nonEmptyLookupByTargetNode.clear();
+    for (auto &shard : shards) {
+      std::lock_guard<std::mutex> lock(shard->Mutex);
+      shard->records.clear();
+      shard->freeRecords = NoRecord;
+      shard->recordOf.clear();
+      for (auto &heads : shard->heads) {
+        heads.clear();
+      }
+      shard->coldTargets.clear();
+    }
+    numInMemory = 0;
+    std::lock_guard<std::mutex> logLock(coldLogMutex);
+    coldLog.reset();
   }
 
   void printJumpFunctions() {
     auto &lg = lg::get();
     BOOST_LOG_SEV(lg, DEBUG) << "Jump Functions:";
-    for (auto &entry : nonEmptyLookupByTargetNode) {
-      BOOST_LOG_SEV(lg, DEBUG) << "Node: " << problem.NtoString(entry.first);
-      for (auto cell : entry.second.cellSet()) {
-        BOOST_LOG_SEV(lg, DEBUG)
-            << "fact at src: " << problem.DtoString(cell.r);
+    for (auto &shard : shards) {
+      std::lock_guard<std::mutex> lock(shard->Mutex);
+      shard->heads[ByTarget].forEach([&](uint64_t target, IdType head) {
         BOOST_LOG_SEV(lg, DEBUG)
-            << "fact at dst: " << problem.DtoString(cell.c);
-        BOOST_LOG_SEV(lg, DEBUG) << "edge fnct: " << cell.v->toString();
-      }
+            << "Node: " << problem.NtoString(nodeIds->get(target));
+        for (IdType id = head; id != NoRecord;
+             id = shard->records[id].next[ByTarget]) {
+          const Record &record = shard->records[id];
+          BOOST_LOG_SEV(lg, DEBUG)
+              << "fact at src: "
+              << problem.DtoString(factIds->get(record.sourceVal));
+          BOOST_LOG_SEV(lg, DEBUG)
+              << "fact at dst: "
+              << problem.DtoString(factIds->get(record.targetVal));
+          BOOST_LOG_SEV(lg, DEBUG)
+              << "edge fnct: "
+              << EdgeFunctionRef<L>::getFromOpaqueValue(record.function)
+                     ->toString();
+        }
+      });
     }
   }
 
   void printNonEmptyReverseLookup() {
     std::cout << "DUMP nonEmptyReverseLookup" << std::endl;
-    std::cout << "Table<N, D, std::map<D, std::shared_ptr<EdgeFunction<L>>>>"
-              << std::endl;
-    auto cellset = nonEmptyReverseLookup.cellSet();
-    for (auto cell : cellset) {
-      cell.r->dump();
-      cell.c->dump();
-      for (auto edgefunction : cell.v) {
-        edgefunction.first->dump();
-        edgefunction.second->dump();
-      }
+    std::cout << "(N, D) -> std::map<D, EdgeFunctionRef<L>>" << std::endl;
+    for (auto &shard : shards) {
+      std::lock_guard<std::mutex> lock(shard->Mutex);
+      shard->heads[ByTargetVal].forEach([&](uint64_t key, IdType head) {
+        nodeIds->get(unpackFirstId(key))->dump();
+        factIds->get(unpackSecondId(key))->dump();
+        for (IdType id = head; id != NoRecord;
+             id = shard->records[id].next[ByTargetVal]) {
+          factIds->get(shard->records[id].sourceVal)->dump();
+          EdgeFunctionRef<L>::getFromOpaqueValue(shard->records[id].function)
+              ->dump();
+        }
+      });
     }
   }
 
   void printNonEmptyForwardLookup() {
     std::cout << "DUMP nonEmptyForwardLookup" << std::endl;
-    std::cout << "Table<D, N, std::map<D, std::shared_ptr<EdgeFunction<L>>>>"
-              << std::endl;
-    auto cellset = nonEmptyForwardLookup.cellSet();
-    for (auto cell : cellset) {
-      cell.r->dump();
-      cell.c->dump();
-      for (auto edgefunction : cell.v) {
-        edgefunction.first->dump();
-        edgefunction.second->dump();
-      }
+    std::cout << "(N, D) -> std::map<D, EdgeFunctionRef<L>>" << std::endl;
+    for (auto &shard : shards) {
+      std::lock_guard<std::mutex> lock(shard->Mutex);
+      shard->heads[BySourceVal].forEach([&](uint64_t key, IdType head) {
+        factIds->get(unpackSecondId(key))->dump();
+        nodeIds->get(unpackFirstId(key))->dump();
+        for (IdType id = head; id != NoRecord;
+             id = shard->records[id].next[BySourceVal]) {
+          factIds->get(shard->records[id].targetVal)->dump();
+          EdgeFunctionRef<L>::getFromOpaqueValue(shard->records[id].function)
+              ->dump();
+        }
+      });
     }
   }
 
   void printNonEmptyLookupByTargetNode() {
     std::cout << "DUMP nonEmptyLookupByTargetNode" << std::endl;
-    std::cout << "std::unordered_map<N, Table<D, D, "
-                 "std::shared_ptr<EdgeFunction<L>>>>"
-              << std::endl;
-    for (auto node : nonEmptyLookupByTargetNode) {
-      node.first->dump();
-      auto table = nonEmptyLookupByTargetNode[node.first];
-      auto cellset = table.cellSet();
-      for (auto cell : cellset) {
-        cell.r->dump();
-        cell.c->dump();
-        cell.v->dump();
-      }
+    std::cout << "N -> (D, D) -> EdgeFunctionRef<L>" << std::endl;
+    for (auto &shard : shards) {
+      std::lock_guard<std::mutex> lock(shard->Mutex);
+      shard->heads[ByTarget].forEach([&](uint64_t target, IdType head) {
+        nodeIds->get(target)->dump();
+        for (IdType id = head; id != NoRecord;
+             id = shard->records[id].next[ByTarget]) {
+          factIds->get(shard->records[id].sourceVal)->dump();
+          factIds->get(shard->records[id].targetVal)->dump();
+          EdgeFunctionRef<L>::getFromOpaqueValue(shard->records[id].function)
+              ->dump();
+        }
+      });
     }
   }
 };
 
+template <typename N, typename D, typename M, typename L, typename I>
+constexpr typename JumpFunctions<N, D, M, L, I>::IdType
+    JumpFunctions<N, D, M, L, I>::NoRecord;
+
 } // namespace psr
 
 #endif /* ANALYSIS_IFDS_IDE_SOLVER_JUMPFUNCTIONS_HH_ */
@@ -54,7 +54,7 @@ public:
     // for the following line have a look at:
     // http://stackoverflow.com/questions/1120833/derived-template-class-access-to-base-class-member-data
     // https://isocpp.org/wiki/faq/templates#nondependent-name-lookup-members
-    auto results = this->valtab.cellSet();
+    auto results = this->valtabCellSet();
     if (results.empty()) {
       std::cout << "EMPTY" << std::endl;
     } else {
@@ -62,7 +62,7 @@ public:
     PAMM_FACTORY;
     START_TIMER("DFA Result Dumping");
     std::cout << "### DUMP LLVMIFDSSolver results\n";
-    auto results = this->valtab.cellSet();
+    auto results = this->valtabCellSet();
     if (results.empty()) {
       std::cout << "EMPTY\n";
     } else {
@@ -192,7 +192,7 @@ public:
       // getJsonRepresentationForInstructionEdge(from, to, document);
       std::cout << "NODE (in function "
                 << TargetNode->getFunction()->getName().str() << ")\n";
-      TargetNode->print(llvm::outs());
+      std::cout << llvmIRToString(TargetNode) << '\n';
 
       auto FlowFactMap = entry.second;
       // for (auto FlowFactEntry : FlowFactMap)
@@ -227,8 +227,8 @@ public:
           if (interEntry.first->getFunction()->getName().str().compare(
                   callerFunction->getName().str()) != 0) {
             std::cout << "callsite: " << std::endl;
-            TargetNode->print(llvm::outs());
-            interEntry.first->print(llvm::outs());
+            std::cout << llvmIRToString(TargetNode) << '\n';
+            std::cout << llvmIRToString(interEntry.first) << '\n';
             json callSiteNode =
                 getJsonRepresentationForCallsite(TargetNode, interEntry.first);
 
@@ -242,7 +242,7 @@ public:
             std::cout << "NODE (in function (inter)"
                       << interEntry.first->getFunction()->getName().str()
                       << ")\n";
-            interEntry.first->print(llvm::outs());
+            std::cout << llvmIRToString(interEntry.first) << '\n';
             // add function start node here
             iterateExplodedSupergraph(interEntry.first,
                                       TargetNode->getFunction(),
@@ -349,7 +349,7 @@ public:
 
       std::cout << "START NODE (in function "
                 << SourceNode->getFunction()->getName().str() << ")\n";
-      SourceNode->print(llvm::outs());
+      std::cout << llvmIRToString(SourceNode) << '\n';
       std::cout << " source node name " << SourceNode->getName().str()
                 << std::endl;
       std::cout << " source node opcode name" << SourceNode->getOpcodeName()
@@ -0,0 +1,184 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef ANALYSIS_IFDS_IDE_SOLVER_MULTIENTRYPOINTSOLVER_H_
+#define ANALYSIS_IFDS_IDE_SOLVER_MULTIENTRYPOINTSOLVER_H_
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <json.hpp>
+#include <memory>
+#include <phasar/Utils/Logger.h>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace psr {
+
+/**
+ * Solves a problem for several groups of entry points in solver instances
+ * of their own, which run on a pool of threads and share the end summaries
+ * of the calling contexts they have analyzed, see
+ * IDESolver::setSharedEndSummaries(). The results of the instances are
+ * merged: facts that hold at a node in any of the instances hold at the node,
+ * values of the same fact are joined.
+ *
+ * An instance publishes the end summaries of a method as soon as the method
+ * and its transitive callees are finished, hence, instances that run
+ * concurrently profit from each other as well, unless their path edges are
+ * processed by multiple threads, in which case they publish once they have
+ * solved their problems completely. The number of threads the instances run
+ * on is independent of SolverConfiguration::numThreads, which applies to each
+ * instance. The problems are created by MakeProblem for each group and must
+ * only share read-only state, such as the ICFG. For IDE problems, the values
+ * inside a callee that an instance has not analyzed itself, as it applied the
+ * summary of another instance, only reflect the contexts of the other
+ * instance.
+ *
+ * @param <ProblemTy> The type of the problems.
+ * @param <SolverTy> The type of the solvers, an IDESolver or one of its
+ * subclasses that is constructible from a ProblemTy.
+ */
+template <typename ProblemTy, typename SolverTy> class MultiEntryPointSolver {
+private:
+  using json = nlohmann::json;
+
+  std::vector<std::unique_ptr<ProblemTy>> Problems;
+  std::vector<std::unique_ptr<SolverTy>> Solvers;
+  typename SolverTy::SharedSummaries Summaries;
+  unsigned NumThreads;
+
+public:
+  MultiEntryPointSolver(
+      std::function<
+          std::unique_ptr<ProblemTy>(const std::vector<std::string> &)>
+          MakeProblem,
+      const std::vector<std::vector<std::string>> &EntryPointGroups,
+      unsigned NumThreads = 1)
+      : NumThreads(std::max<unsigned>(NumThreads, 1)) {
+    if (EntryPointGroups.empty()) {
+      throw std::runtime_error("MultiEntryPointSolver: no entry points given");
+    }
+    for (auto &EntryPoints : EntryPointGroups) {
+      Problems.push_back(MakeProblem(EntryPoints));
+      Solvers.push_back(std::make_unique<SolverTy>(*Problems.back()));
+      Solvers.back()->setSharedEndSummaries(&Summaries);
+    }
+  }
+
+  MultiEntryPointSolver(const MultiEntryPointSolver &) = delete;
+  MultiEntryPointSolver &operator=(const MultiEntryPointSolver &) = delete;
+
+  /// Solves the problems of all groups. Rethrows the first exception that
+  /// has been thrown by an instance once all of them have finished.
+  void solve() {
+    auto &lg = lg::get();
+    std::vector<std::exception_ptr> Errors(Solvers.size());
+    std::atomic<size_t> NextSolver(0);
+    auto Work = [&]() {
+      for (size_t Idx = NextSolver++; Idx < Solvers.size();
+           Idx = NextSolver++) {
+        try {
+          Solvers[Idx]->solve();
+        } catch (...) {
+          Errors[Idx] = std::current_exception();
+        }
+      }
+    };
+    std::vector<std::thread> Workers;
+    for (size_t T = 1; T < std::min<size_t>(NumThreads, Solvers.size()); ++T) {
+      Workers.emplace_back(Work);
+    }
+    Work();
+    for (auto &Worker : Workers) {
+      Worker.join();
+    }
+    for (auto &Error : Errors) {
+      if (Error) {
+        std::rethrow_exception(Error);
+      }
+    }
+    BOOST_LOG_SEV(lg, INFO)
+        << "Solved " << Solvers.size() << " groups of entry points, "
+        << Summaries.size() << " shared end summaries, " << Summaries.getHits()
+        << " applied";
+  }
+
+  /// Returns the number of groups of entry points.
+  size_t size() const { return Solvers.size(); }
+
+  ProblemTy &getProblem(size_t K) { return *Problems[K]; }
+
+  SolverTy &getSolver(size_t K) { return *Solvers[K]; }
+
+  /// Returns the facts that hold at stmt in any of the instances, only
+  /// available if SolverTy is an IFDSSolver.
+  template <typename N> auto ifdsResultsAt(N stmt) {
+    auto Results = Solvers.front()->ifdsResultsAt(stmt);
+    for (size_t K = 1; K < Solvers.size(); ++K) {
+      auto Facts = Solvers[K]->ifdsResultsAt(stmt);
+      Results.insert(Facts.begin(), Facts.end());
+    }
+    return Results;
+  }
+
+  /// Returns the facts that hold at stmt in any of the instances along with
+  /// the join of their values.
+  template <typename N> auto resultsAt(N stmt, bool stripZero = false) {
+    auto Results = Solvers.front()->resultsAt(stmt, stripZero);
+    for (size_t K = 1; K < Solvers.size(); ++K) {
+      for (auto &Entry : Solvers[K]->resultsAt(stmt, stripZero)) {
+        auto Search = Results.find(Entry.first);
+        if (Search == Results.end()) {
+          Results.insert(Entry);
+        } else {
+          Search->second =
+              Problems.front()->join(Search->second, Entry.second);
+        }
+      }
+    }
+    return Results;
+  }
+
+  /// Returns the merged results in the format of IDESolver::getAsJson(),
+  /// facts that hold in several instances are listed once per value.
+  json getAsJson() {
+    const static std::string DataFlowID = "DataFlow";
+    json J;
+    std::unordered_map<std::string, std::set<std::string>> Listed;
+    for (auto &Solver : Solvers) {
+      json Results = Solver->getAsJson();
+      if (!Results[DataFlowID].is_object()) {
+        continue;
+      }
+      for (auto Node = Results[DataFlowID].begin();
+           Node != Results[DataFlowID].end(); ++Node) {
+        std::set<std::string> &Facts = Listed[Node.key()];
+        for (auto &Fact : Node.value()["Facts"]) {
+          if (Facts.insert(Fact.dump()).second) {
+            J[DataFlowID][Node.key()]["Facts"].push_back(Fact);
+          }
+        }
+      }
+    }
+    if (J.find(DataFlowID) == J.end()) {
+      J[DataFlowID] = "EMPTY";
+    }
+    return J;
+  }
+};
+
+} // namespace psr
+
+#endif /* ANALYSIS_IFDS_IDE_SOLVER_MULTIENTRYPOINTSOLVER_H_ */
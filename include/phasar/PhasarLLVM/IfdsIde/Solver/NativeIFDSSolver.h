@@ -0,0 +1,307 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef ANALYSIS_IFDS_IDE_SOLVER_NATIVEIFDSSOLVER_H_
+#define ANALYSIS_IFDS_IDE_SOLVER_NATIVEIFDSSOLVER_H_
+
+#include <map>
+#include <memory>
+#include <phasar/PhasarLLVM/IfdsIde/FlowEdgeFunctionCache.h>
+#include <phasar/PhasarLLVM/IfdsIde/IFDSTabulationProblem.h>
+#include <phasar/PhasarLLVM/IfdsIde/Solver/IFDSToIDETabulationProblem.h>
+#include <phasar/PhasarLLVM/IfdsIde/Solver/PathEdge.h>
+#include <phasar/PhasarLLVM/IfdsIde/Solver/PathEdgeWorkList.h>
+#include <phasar/PhasarLLVM/Utils/BinaryDomain.h>
+#include <phasar/Utils/Interner.h>
+#include <phasar/Utils/Logger.h>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace psr {
+
+/**
+ * Solves IFDS problems using the tabulation algorithm of Reps, Horwitz and
+ * Sagiv without promoting them to IDE problems first.
+ *
+ * In contrast to the IFDSSolver, which runs an IDESolver over the binary
+ * domain, this solver only records which path edges and end summaries exist.
+ * No edge functions are constructed, composed or joined, and as reachability
+ * is all there is to compute, there is no second (value computation) phase.
+ * Nodes and facts are interned into dense ids, a path edge <sP,d1> -> <n,d2>
+ * is stored as a single 64-bit key (d1,d2) in the set of node n.
+ *
+ * The results equal those of the IFDSSolver and can be queried using
+ * ifdsResultsAt(). For problems that follow returns past their seeds, the
+ * facts that are returned into callers that have never been called are
+ * reported as well, whereas the value phase of the IFDSSolver does not reach
+ * them. The solver processes the path edges on a single thread and does not
+ * record the edges of the exploded super graph.
+ *
+ * @param <N> The type of nodes in the interprocedural control-flow graph.
+ * @param <D> The type of data-flow facts to be computed by the tabulation
+ * problem.
+ * @param <M> The type of objects used to represent methods.
+ * @param <I> The type of inter-procedural control-flow graph being used.
+ */
+template <typename N, typename D, typename M, typename I>
+class NativeIFDSSolver {
+public:
+  using IdType = typename Interner<D>::IdType;
+
+private:
+  IFDSTabulationProblem<N, D, M, I> &ifdsProblem;
+  // only used to share the flow function cache with the IDESolver
+  IFDSToIDETabulationProblem<N, D, M, I> ideProblem;
+  FlowEdgeFunctionCache<N, D, M, BinaryDomain, I> cachedFlowFunctions;
+  I icfg;
+  D zeroValue;
+  bool followReturnsPastSeeds;
+  std::map<N, std::set<D>> initialSeeds;
+  Interner<N> nodeIds;
+  Interner<D> factIds;
+  IdType zeroId;
+  PathEdgeWorkList<IdType, IdType> pathEdgeWorkList;
+  // indexed by the target node, contains the keys packIds(d1, d2)
+  std::vector<std::unordered_set<uint64_t>> pathEdges;
+  size_t numPathEdges = 0;
+  // keyed by packIds(callSite, d2), contains all d1 of processed path edges
+  // <sP,d1> -> <callSite,d2>
+  std::unordered_map<uint64_t, std::vector<IdType>> callSiteSources;
+  // keyed by packIds(sP, d1), contains the keys packIds(eP, d2)
+  std::unordered_map<uint64_t, std::vector<uint64_t>> endsummarytab;
+  // keyed by packIds(sP, d3), maps call sites to the facts d2 at the call site
+  std::unordered_map<uint64_t, std::unordered_map<IdType, std::set<IdType>>>
+      incomingtab;
+
+  IdType nodeId(N n) { return nodeIds.getOrCreateId(n); }
+
+  IdType factId(D d) { return factIds.getOrCreateId(d); }
+
+  N node(IdType n) const { return nodeIds.get(n); }
+
+  D fact(IdType d) const { return factIds.get(d); }
+
+  void propagate(IdType sourceVal, IdType target, IdType targetVal) {
+    if (target >= pathEdges.size()) {
+      pathEdges.resize(nodeIds.size());
+    }
+    if (pathEdges[target].insert(packIds(sourceVal, targetVal)).second) {
+      ++numPathEdges;
+      pathEdgeWorkList.push(
+          PathEdge<IdType, IdType>(sourceVal, target, targetVal));
+    }
+  }
+
+  void processCall(IdType d1, IdType nId, IdType d2) {
+    N n = node(nId);
+    callSiteSources[packIds(nId, d2)].push_back(d1);
+    std::set<M> callees = icfg.getCalleesOfCallAt(n);
+    std::set<N> returnSiteNs = icfg.getReturnSitesOfCallAt(n);
+    for (M sCalledProcN : callees) {
+      std::shared_ptr<FlowFunction<D>> specialSum =
+          cachedFlowFunctions.getSummaryFlowFunction(n, sCalledProcN);
+      if (specialSum) {
+        FFSet<D> res = specialSum->computeTargetSet(fact(d2));
+        for (N returnSiteN : returnSiteNs) {
+          for (D d3 : res) {
+            propagate(d1, nodeId(returnSiteN), factId(d3));
+          }
+        }
+      } else {
+        std::shared_ptr<FlowFunction<D>> function =
+            cachedFlowFunctions.getCallFlowFunction(n, sCalledProcN);
+        FFSet<D> res = function->computeTargetSet(fact(d2));
+        for (N sP : icfg.getStartPointsOf(sCalledProcN)) {
+          IdType sPId = nodeId(sP);
+          for (D d3 : res) {
+            IdType d3Id = factId(d3);
+            // create initial self-loop
+            propagate(d3Id, sPId, d3Id);
+            incomingtab[packIds(sPId, d3Id)][nId].insert(d2);
+            // copy, returning may add end summaries to this context
+            std::vector<uint64_t> endSumm = endsummarytab[packIds(sPId, d3Id)];
+            for (uint64_t exit : endSumm) {
+              N eP = node(unpackFirstId(exit));
+              D d4 = fact(unpackSecondId(exit));
+              for (N retSiteN : returnSiteNs) {
+                std::shared_ptr<FlowFunction<D>> retFunction =
+                    cachedFlowFunctions.getRetFlowFunction(n, sCalledProcN, eP,
+                                                           retSiteN);
+                for (D d5 : retFunction->computeTargetSet(d4)) {
+                  propagate(d1, nodeId(retSiteN), factId(d5));
+                }
+              }
+            }
+          }
+        }
+      }
+      for (N returnSiteN : returnSiteNs) {
+        std::shared_ptr<FlowFunction<D>> callToReturnFlowFunction =
+            cachedFlowFunctions.getCallToRetFlowFunction(n, returnSiteN,
+                                                         callees);
+        for (D d3 : callToReturnFlowFunction->computeTargetSet(fact(d2))) {
+          propagate(d1, nodeId(returnSiteN), factId(d3));
+        }
+      }
+    }
+  }
+
+  void processExit(IdType d1, IdType nId, IdType d2) {
+    N n = node(nId);
+    M methodThatNeedsSummary = icfg.getMethodOf(n);
+    std::unordered_map<IdType, std::set<IdType>> inc;
+    for (N sP : icfg.getStartPointsOf(methodThatNeedsSummary)) {
+      uint64_t context = packIds(nodeId(sP), d1);
+      endsummarytab[context].push_back(packIds(nId, d2));
+      auto search = incomingtab.find(context);
+      if (search != incomingtab.end()) {
+        for (auto &entry : search->second) {
+          inc[entry.first].insert(entry.second.begin(), entry.second.end());
+        }
+      }
+    }
+    for (auto &entry : inc) {
+      N c = node(entry.first);
+      for (N retSiteC : icfg.getReturnSitesOfCallAt(c)) {
+        std::shared_ptr<FlowFunction<D>> retFunction =
+            cachedFlowFunctions.getRetFlowFunction(c, methodThatNeedsSummary,
+                                                   n, retSiteC);
+        FFSet<D> targets = retFunction->computeTargetSet(fact(d2));
+        IdType retSiteId = nodeId(retSiteC);
+        for (IdType d4 : entry.second) {
+          auto search = callSiteSources.find(packIds(entry.first, d4));
+          if (search == callSiteSources.end()) {
+            continue;
+          }
+          // copy, propagating may add sources at recursive call sites
+          std::vector<IdType> sources = search->second;
+          for (IdType d3 : sources) {
+            for (D d5 : targets) {
+              propagate(d3, retSiteId, factId(d5));
+            }
+          }
+        }
+      }
+    }
+    // handling for unbalanced problems where we return out of a method with a
+    // fact for which we have no incoming flow, see IDESolver::processExit()
+    if (followReturnsPastSeeds && inc.empty() && d1 == zeroId) {
+      std::set<N> callers = icfg.getCallersOf(methodThatNeedsSummary);
+      for (N c : callers) {
+        for (N retSiteC : icfg.getReturnSitesOfCallAt(c)) {
+          std::shared_ptr<FlowFunction<D>> retFunction =
+              cachedFlowFunctions.getRetFlowFunction(c, methodThatNeedsSummary,
+                                                     n, retSiteC);
+          for (D d5 : retFunction->computeTargetSet(fact(d2))) {
+            propagate(zeroId, nodeId(retSiteC), factId(d5));
+          }
+        }
+      }
+      if (callers.empty()) {
+        std::shared_ptr<FlowFunction<D>> retFunction =
+            cachedFlowFunctions.getRetFlowFunction(
+                nullptr, methodThatNeedsSummary, n, nullptr);
+        retFunction->computeTargetSet(fact(d2));
+      }
+    }
+  }
+
+  void processNormalFlow(IdType d1, IdType nId, IdType d2) {
+    N n = node(nId);
+    for (N m : icfg.getSuccsOf(n)) {
+      std::shared_ptr<FlowFunction<D>> flowFunction =
+          cachedFlowFunctions.getNormalFlowFunction(n, m);
+      for (D d3 : flowFunction->computeTargetSet(fact(d2))) {
+        propagate(d1, nodeId(m), factId(d3));
+      }
+    }
+  }
+
+  void pathEdgeProcessingTask(PathEdge<IdType, IdType> edge) {
+    N n = node(edge.getTarget());
+    if (!icfg.isCallStmt(n)) {
+      if (icfg.isExitStmt(n)) {
+        processExit(edge.factAtSource(), edge.getTarget(),
+                    edge.factAtTarget());
+      }
+      if (!icfg.getSuccsOf(n).empty()) {
+        processNormalFlow(edge.factAtSource(), edge.getTarget(),
+                          edge.factAtTarget());
+      }
+    } else {
+      processCall(edge.factAtSource(), edge.getTarget(), edge.factAtTarget());
+    }
+  }
+
+public:
+  NativeIFDSSolver(IFDSTabulationProblem<N, D, M, I> &ifdsProblem)
+      : ifdsProblem(ifdsProblem), ideProblem(ifdsProblem),
+        cachedFlowFunctions(ideProblem), icfg(ifdsProblem.interproceduralCFG()),
+        zeroValue(ifdsProblem.zeroValue()),
+        followReturnsPastSeeds(
+            ifdsProblem.solver_config.followReturnsPastSeeds),
+        initialSeeds(ifdsProblem.initialSeeds()),
+        zeroId(factIds.getOrCreateId(zeroValue)),
+        pathEdgeWorkList(ifdsProblem.solver_config.workListStrategy) {}
+
+  virtual ~NativeIFDSSolver() = default;
+
+  /**
+   * @brief Runs the solver on the configured problem. This can take some time.
+   */
+  virtual void solve() {
+    auto &lg = lg::get();
+    BOOST_LOG_SEV(lg, INFO) << "Native IFDS solver is solving the specified "
+                               "problem";
+    BOOST_LOG_SEV(lg, INFO) << "Path edge work list strategy: "
+                            << pathEdgeWorkList.getStrategy();
+    for (const auto &seed : initialSeeds) {
+      IdType startPoint = nodeId(seed.first);
+      for (const D &value : seed.second) {
+        propagate(zeroId, startPoint, factId(value));
+      }
+      while (!pathEdgeWorkList.empty()) {
+        pathEdgeProcessingTask(pathEdgeWorkList.pop());
+      }
+      // see IDESolver::submitInitalSeeds(), the edge is recorded, but not
+      // processed
+      if (startPoint >= pathEdges.size()) {
+        pathEdges.resize(nodeIds.size());
+      }
+      if (pathEdges[startPoint].insert(packIds(zeroId, zeroId)).second) {
+        ++numPathEdges;
+      }
+    }
+    BOOST_LOG_SEV(lg, INFO) << "Max. number of pending path edges: "
+                            << pathEdgeWorkList.maxSize();
+    BOOST_LOG_SEV(lg, INFO) << "Number of path edges: " << numPathEdges;
+    BOOST_LOG_SEV(lg, INFO) << "Problem solved";
+  }
+
+  /// Returns the facts that hold at the given statement.
+  std::set<D> ifdsResultsAt(N stmt) {
+    std::set<D> keyset;
+    IdType n = nodeIds.getId(stmt);
+    if (n < pathEdges.size()) {
+      for (uint64_t edge : pathEdges[n]) {
+        keyset.insert(fact(unpackSecondId(edge)));
+      }
+    }
+    return keyset;
+  }
+
+  /// Returns the number of distinct path edges that have been computed.
+  size_t getNumPathEdges() const { return numPathEdges; }
+};
+
+} // namespace psr
+
+#endif /* ANALYSIS_IFDS_IDE_SOLVER_NATIVEIFDSSOLVER_H_ */
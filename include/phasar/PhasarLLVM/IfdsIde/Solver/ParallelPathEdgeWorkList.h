@@ -0,0 +1,242 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef ANALYSIS_IFDS_IDE_SOLVER_PARALLELPATHEDGEWORKLIST_H_
+#define ANALYSIS_IFDS_IDE_SOLVER_PARALLELPATHEDGEWORKLIST_H_
+
+#include <algorithm>
+#include <atomic>
+#include <boost/optional.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <phasar/PhasarLLVM/IfdsIde/Solver/PathEdge.h>
+#include <phasar/PhasarLLVM/IfdsIde/SolverConfiguration.h>
+#include <thread>
+#include <vector>
+
+namespace psr {
+
+/**
+ * Work list that distributes the processing of path edges across a pool of
+ * worker threads. Every worker owns a deque into which it pushes the path
+ * edges it discovers and from which it pops according to the configured
+ * strategy. A worker that runs out of work steals the oldest path edge of
+ * one of the other workers, or sleeps until a path edge is pushed.
+ *
+ * @param <N> The type of nodes in the interprocedural control-flow graph.
+ * @param <D> The type of data-flow facts to be computed by the tabulation
+ * problem.
+ */
+template <typename N, typename D> class ParallelPathEdgeWorkList {
+private:
+  struct WorkerQueue {
+    std::mutex Mutex;
+    std::deque<PathEdge<N, D>> Edges;
+  };
+
+  WorkListStrategy Strategy;
+  std::vector<std::unique_ptr<WorkerQueue>> Queues;
+  // number of path edges that have been pushed, but whose processing has not
+  // been finished yet
+  std::atomic<size_t> Pending;
+  // number of path edges that are still in one of the queues
+  std::atomic<size_t> Queued;
+  // idle workers wait on IdleCondition until there is work or the run ends
+  std::mutex IdleMutex;
+  std::condition_variable IdleCondition;
+  std::atomic<size_t> Sleeping;
+  // set once a worker failed, the others stop before their next path edge
+  std::atomic<bool> Failed;
+  std::exception_ptr Error;
+
+  /// Index of the worker the calling thread is acting as.
+  static size_t &workerIndex() {
+    static thread_local size_t Index = 0;
+    return Index;
+  }
+
+  boost::optional<PathEdge<N, D>> popOwn(size_t Worker) {
+    WorkerQueue &Q = *Queues[Worker];
+    std::lock_guard<std::mutex> Lock(Q.Mutex);
+    if (Q.Edges.empty()) {
+      return boost::none;
+    }
+    if (Strategy == WorkListStrategy::LIFO) {
+      PathEdge<N, D> Edge = Q.Edges.back();
+      Q.Edges.pop_back();
+      --Queued;
+      return Edge;
+    }
+    PathEdge<N, D> Edge = Q.Edges.front();
+    Q.Edges.pop_front();
+    --Queued;
+    return Edge;
+  }
+
+  boost::optional<PathEdge<N, D>> steal(size_t Worker) {
+    for (size_t I = 1; I < Queues.size(); ++I) {
+      WorkerQueue &Q = *Queues[(Worker + I) % Queues.size()];
+      std::lock_guard<std::mutex> Lock(Q.Mutex);
+      if (!Q.Edges.empty()) {
+        PathEdge<N, D> Edge = Q.Edges.front();
+        Q.Edges.pop_front();
+        --Queued;
+        return Edge;
+      }
+    }
+    return boost::none;
+  }
+
+  void wakeAll() {
+    { std::lock_guard<std::mutex> Lock(IdleMutex); }
+    IdleCondition.notify_all();
+  }
+
+  /// Blocks until a path edge may be available or the run has to end. The
+  /// timeout makes sure that a Stop function is asked regularly.
+  void waitForWork() {
+    std::unique_lock<std::mutex> Lock(IdleMutex);
+    ++Sleeping;
+    IdleCondition.wait_for(Lock, std::chrono::milliseconds(1), [this] {
+      return Queued != 0 || Pending == 0 || Failed;
+    });
+    --Sleeping;
+  }
+
+public:
+  ParallelPathEdgeWorkList(size_t NumWorkers,
+                           WorkListStrategy Strategy = WorkListStrategy::FIFO)
+      : Strategy(Strategy), Pending(0), Queued(0), Sleeping(0),
+        Failed(false) {
+    for (size_t I = 0; I < std::max<size_t>(NumWorkers, 1); ++I) {
+      Queues.push_back(std::make_unique<WorkerQueue>());
+    }
+  }
+
+  ~ParallelPathEdgeWorkList() = default;
+
+  /**
+   * Pushes a path edge into the queue of the worker the calling thread is
+   * acting as. Threads that are not part of the pool push into the first
+   * queue.
+   */
+  void push(PathEdge<N, D> Edge) {
+    WorkerQueue &Q = *Queues[workerIndex() % Queues.size()];
+    ++Pending;
+    {
+      std::lock_guard<std::mutex> Lock(Q.Mutex);
+      Q.Edges.push_back(Edge);
+    }
+    ++Queued;
+    if (Sleeping != 0) {
+      { std::lock_guard<std::mutex> Lock(IdleMutex); }
+      IdleCondition.notify_one();
+    }
+  }
+
+  bool empty() const { return Pending == 0; }
+
+  size_t getNumWorkers() const { return Queues.size(); }
+
+  WorkListStrategy getStrategy() const { return Strategy; }
+
+  /// Calls F for every pending path edge. Must not be called while running.
+  template <typename Fn> void forEach(Fn F) {
+    for (auto &Q : Queues) {
+      std::lock_guard<std::mutex> Lock(Q->Mutex);
+      for (const PathEdge<N, D> &Edge : Q->Edges) {
+        F(Edge);
+      }
+    }
+  }
+
+  /**
+   * Processes all pending path edges, as well as all path edges that are
+   * pushed while doing so, using the given function on the worker threads.
+   * The calling thread participates as the first worker. Returns once no
+   * path edge is left.
+   */
+  template <typename Fn> void run(Fn Process) {
+    run(Process, [] { return false; });
+  }
+
+  /**
+   * Like run(Process), but also returns once Stop returns true, which every
+   * worker asks before it takes the next path edge. The path edges that have
+   * not been processed remain pending. If Process throws, the other workers
+   * stop before their next path edge and the first exception is rethrown on
+   * the calling thread once all workers have been joined.
+   */
+  template <typename Fn, typename StopFn> void run(Fn Process, StopFn Stop) {
+    Failed = false;
+    Error = nullptr;
+    auto Work = [this, &Process, &Stop](size_t Worker) {
+      workerIndex() = Worker;
+      try {
+        while (Pending != 0 && !Failed && !Stop()) {
+          boost::optional<PathEdge<N, D>> Edge = popOwn(Worker);
+          if (!Edge) {
+            Edge = steal(Worker);
+          }
+          if (!Edge) {
+            waitForWork();
+            continue;
+          }
+          try {
+            Process(*Edge);
+          } catch (...) {
+            --Pending;
+            throw;
+          }
+          if (--Pending == 0) {
+            wakeAll();
+          }
+        }
+      } catch (...) {
+        std::lock_guard<std::mutex> Lock(IdleMutex);
+        if (!Error) {
+          Error = std::current_exception();
+        }
+        Failed = true;
+        IdleCondition.notify_all();
+      }
+    };
+    std::vector<std::thread> Workers;
+    try {
+      for (size_t I = 1; I < Queues.size(); ++I) {
+        Workers.emplace_back(Work, I);
+      }
+    } catch (...) {
+      // the threads that have been started must be joined before unwinding
+      Failed = true;
+      wakeAll();
+      for (auto &Worker : Workers) {
+        Worker.join();
+      }
+      throw;
+    }
+    size_t CallerIndex = workerIndex();
+    Work(0);
+    workerIndex() = CallerIndex;
+    for (auto &Worker : Workers) {
+      Worker.join();
+    }
+    if (Error) {
+      std::rethrow_exception(Error);
+    }
+  }
+};
+
+} // namespace psr
+
+#endif /* ANALYSIS_IFDS_IDE_SOLVER_PARALLELPATHEDGEWORKLIST_H_ */
@@ -0,0 +1,154 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef ANALYSIS_IFDS_IDE_SOLVER_PATHEDGEWORKLIST_H_
+#define ANALYSIS_IFDS_IDE_SOLVER_PATHEDGEWORKLIST_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <phasar/PhasarLLVM/IfdsIde/Solver/PathEdge.h>
+#include <phasar/PhasarLLVM/IfdsIde/SolverConfiguration.h>
+#include <vector>
+
+namespace psr {
+
+/**
+ * Holds the path edges that have been propagated but not yet processed by the
+ * solver. Instead of processing a new path edge right away (which leads to a
+ * recursion as deep as the longest chain of propagations) the solver pushes
+ * it into this work list and drains the list in a flat loop.
+ *
+ * With a prioritized strategy, every path edge is pushed along with a
+ * priority; the path edge with the smallest priority is handed out first,
+ * path edges of equal priority in the order in which they were pushed.
+ *
+ * @param <N> The type of nodes in the interprocedural control-flow graph.
+ * @param <D> The type of data-flow facts to be computed by the tabulation
+ * problem.
+ */
+template <typename N, typename D> class PathEdgeWorkList {
+private:
+  struct PrioritizedEdge {
+    uint64_t Priority;
+    uint64_t Sequence;
+    PathEdge<N, D> Edge;
+  };
+
+  // orders the heap such that its front is the edge to be handed out next
+  struct HandedOutLater {
+    bool operator()(const PrioritizedEdge &A,
+                    const PrioritizedEdge &B) const {
+      return A.Priority != B.Priority ? A.Priority > B.Priority
+                                      : A.Sequence > B.Sequence;
+    }
+  };
+
+  WorkListStrategy Strategy;
+  std::deque<PathEdge<N, D>> WorkList;
+  std::vector<PrioritizedEdge> Heap;
+  uint64_t NextSequence = 0;
+  size_t MaxSize = 0;
+
+public:
+  PathEdgeWorkList(WorkListStrategy Strategy = WorkListStrategy::FIFO)
+      : Strategy(Strategy) {}
+
+  ~PathEdgeWorkList() = default;
+
+  /// Returns true if the order of the path edges depends on their priority.
+  bool isPrioritized() const {
+    return Strategy == WorkListStrategy::ReversePostOrder ||
+           Strategy == WorkListStrategy::CalleeFirst;
+  }
+
+  /**
+   * Pushes a path edge; the priority is ignored unless the strategy is
+   * prioritized.
+   */
+  void push(PathEdge<N, D> Edge, uint64_t Priority = 0) {
+    if (isPrioritized()) {
+      Heap.push_back(PrioritizedEdge{Priority, NextSequence++, Edge});
+      std::push_heap(Heap.begin(), Heap.end(), HandedOutLater());
+    } else {
+      WorkList.push_back(Edge);
+    }
+    if (size() > MaxSize) {
+      MaxSize = size();
+    }
+  }
+
+  /**
+   * Removes and returns the next path edge according to the strategy the
+   * work list has been configured with.
+   */
+  PathEdge<N, D> pop() {
+    if (isPrioritized()) {
+      std::pop_heap(Heap.begin(), Heap.end(), HandedOutLater());
+      PathEdge<N, D> Edge = Heap.back().Edge;
+      Heap.pop_back();
+      return Edge;
+    }
+    if (Strategy == WorkListStrategy::LIFO) {
+      PathEdge<N, D> Edge = WorkList.back();
+      WorkList.pop_back();
+      return Edge;
+    }
+    PathEdge<N, D> Edge = WorkList.front();
+    WorkList.pop_front();
+    return Edge;
+  }
+
+  /**
+   * Removes the path edges to Target that would be handed out next, one
+   * after another, and appends them to Edges.
+   */
+  void popWhileTarget(N Target, std::vector<PathEdge<N, D>> &Edges) {
+    while (!empty() && peek().getTarget() == Target) {
+      Edges.push_back(pop());
+    }
+  }
+
+  /// Returns the path edge that pop() would remove next.
+  PathEdge<N, D> peek() const {
+    if (isPrioritized()) {
+      return Heap.front().Edge;
+    }
+    return (Strategy == WorkListStrategy::LIFO) ? WorkList.back()
+                                                : WorkList.front();
+  }
+
+  bool empty() const { return WorkList.empty() && Heap.empty(); }
+
+  /// Calls Fn for every pending path edge.
+  template <typename Fn> void forEach(Fn F) const {
+    for (const PathEdge<N, D> &Edge : WorkList) {
+      F(Edge);
+    }
+    for (const PrioritizedEdge &Entry : Heap) {
+      F(Entry.Edge);
+    }
+  }
+
+  size_t size() const { return WorkList.size() + Heap.size(); }
+
+  /// Returns the largest number of path edges that were pending at once.
+  size_t maxSize() const { return MaxSize; }
+
+  WorkListStrategy getStrategy() const { return Strategy; }
+
+  void clear() {
+    WorkList.clear();
+    Heap.clear();
+  }
+};
+
+} // namespace psr
+
+#endif /* ANALYSIS_IFDS_IDE_SOLVER_PATHEDGEWORKLIST_H_ */
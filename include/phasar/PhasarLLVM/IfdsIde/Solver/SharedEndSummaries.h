@@ -0,0 +1,124 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef ANALYSIS_IFDS_IDE_SOLVER_SHAREDENDSUMMARIES_H_
+#define ANALYSIS_IFDS_IDE_SOLVER_SHAREDENDSUMMARIES_H_
+
+#include <algorithm>
+#include <atomic>
+#include <boost/functional/hash.hpp>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <phasar/PhasarLLVM/IfdsIde/EdgeFunction.h>
+#include <shared_mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace psr {
+
+/**
+ * Holds the end summaries of calling contexts that several solver instances
+ * share, see IDESolver::setSharedEndSummaries(). An end summary lists the
+ * exits, along with their facts and edge functions, that are reachable from
+ * a start point and fact <sP, d1>. Only complete end summaries are added,
+ * and they are never modified afterwards, such that the instances apply
+ * them instead of analyzing the callee again.
+ *
+ * The store is partitioned into shards that are guarded by reader-writer
+ * locks of their own, as it is looked up far more often than it is written.
+ */
+template <typename N, typename D, typename V> class SharedEndSummaries {
+public:
+  struct Exit {
+    N Node;
+    D Fact;
+    std::shared_ptr<EdgeFunction<V>> Function;
+  };
+
+private:
+  using Context = std::pair<N, D>;
+
+  struct ContextHash {
+    size_t operator()(const Context &C) const {
+      size_t H = 0;
+      boost::hash_combine(H, std::hash<N>()(C.first));
+      boost::hash_combine(H, std::hash<D>()(C.second));
+      return H;
+    }
+  };
+
+  struct Shard {
+    std::shared_timed_mutex Mutex;
+    // nodes of unordered maps never move, hence, the summaries stay in place
+    std::unordered_map<Context, std::vector<Exit>, ContextHash> Summaries;
+  };
+
+  std::vector<std::unique_ptr<Shard>> Shards;
+  mutable std::atomic<size_t> Hits;
+  mutable std::atomic<size_t> Misses;
+
+  Shard &getShard(const Context &C) const {
+    return *Shards[ContextHash()(C) % Shards.size()];
+  }
+
+public:
+  explicit SharedEndSummaries(size_t NumShards = 16) : Hits(0), Misses(0) {
+    NumShards = std::max<size_t>(NumShards, 1);
+    for (size_t I = 0; I < NumShards; ++I) {
+      Shards.push_back(std::make_unique<Shard>());
+    }
+  }
+
+  SharedEndSummaries(const SharedEndSummaries &) = delete;
+  SharedEndSummaries &operator=(const SharedEndSummaries &) = delete;
+
+  /// Adds the complete end summary of the calling context <sP, d1>. Returns
+  /// false and drops the given summary if the context is summarized already.
+  bool add(N sP, D d1, std::vector<Exit> Exits) {
+    Context C(sP, d1);
+    Shard &S = getShard(C);
+    std::unique_lock<std::shared_timed_mutex> Lock(S.Mutex);
+    return S.Summaries.emplace(C, std::move(Exits)).second;
+  }
+
+  /// Returns the end summary of the calling context <sP, d1>, or nullptr if
+  /// there is none. The summary stays valid as long as the store lives.
+  const std::vector<Exit> *find(N sP, D d1) const {
+    Context C(sP, d1);
+    Shard &S = getShard(C);
+    std::shared_lock<std::shared_timed_mutex> Lock(S.Mutex);
+    auto Search = S.Summaries.find(C);
+    if (Search == S.Summaries.end()) {
+      ++Misses;
+      return nullptr;
+    }
+    ++Hits;
+    return &Search->second;
+  }
+
+  /// Returns the number of summarized calling contexts.
+  size_t size() const {
+    size_t Size = 0;
+    for (auto &S : Shards) {
+      std::shared_lock<std::shared_timed_mutex> Lock(S->Mutex);
+      Size += S->Summaries.size();
+    }
+    return Size;
+  }
+
+  size_t getHits() const { return Hits; }
+
+  size_t getMisses() const { return Misses; }
+};
+
+} // namespace psr
+
+#endif /* ANALYSIS_IFDS_IDE_SOLVER_SHAREDENDSUMMARIES_H_ */
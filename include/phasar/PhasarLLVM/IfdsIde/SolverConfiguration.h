@@ -17,10 +17,45 @@
 #ifndef ANALYSIS_IFDS_IDE_SOLVERCONFIGURATION_H_
 #define ANALYSIS_IFDS_IDE_SOLVERCONFIGURATION_H_
 
+#include <cstddef>
 #include <iostream>
+#include <map>
+#include <phasar/Utils/CancellationToken.h>
+#include <string>
 
 namespace psr {
 
+// Describes the order in which the solver's worklist hands out path edges.
+// ReversePostOrder prefers path edges whose target comes first in a reverse
+// postorder of its method's control-flow graph, such that the facts of a
+// loop are joined before they are propagated past it. CalleeFirst
+// additionally prefers methods that come first in a bottom-up order of the
+// call graph's strongly connected components. Both only apply to a single
+// thread.
+enum class WorkListStrategy { FIFO = 0, LIFO, ReversePostOrder, CalleeFirst };
+
+extern const std::map<std::string, WorkListStrategy> StringToWorkListStrategy;
+
+extern const std::map<WorkListStrategy, std::string> WorkListStrategyToString;
+
+std::ostream &operator<<(std::ostream &os, const WorkListStrategy &S);
+
+// Describes how the last run of a solver ended. Unsolved until a run has
+// finished, Solved if the run has processed all path edges, otherwise the
+// reason it has been interrupted, see the budgets of SolverConfiguration.
+enum class SolverStatus {
+  Unsolved = 0,
+  Solved,
+  Cancelled,
+  PathEdgeLimitReached,
+  MemoryLimitReached,
+  TimeLimitReached
+};
+
+extern const std::map<SolverStatus, std::string> SolverStatusToString;
+
+std::ostream &operator<<(std::ostream &os, const SolverStatus &S);
+
 struct SolverConfiguration {
   SolverConfiguration() = default;
   SolverConfiguration(bool followReturnsPastSeeds, bool autoAddZero,
@@ -40,6 +75,90 @@ struct SolverConfiguration {
   bool computeValues = false;
   bool recordEdges = false;
   bool computePersistedSummaries = false;
+  // Computes the values of nodes that are neither calls nor start points on
+  // demand, when they are first asked for, rather than for all nodes at the
+  // end of the analysis. Only takes effect if computeValues is enabled.
+  bool computeValuesLazily = false;
+  // Steps over the nodes inside straight-line code, i.e. nodes whose only
+  // predecessor has no other successor, such that jump functions are only
+  // stored at the boundaries of basic blocks and at call sites. The jump
+  // functions inside the blocks are reconstructed when they are needed.
+  bool blockwisePropagation = false;
+  // Passes each fact directly past the statements that do not affect it,
+  // see IFDSTabulationProblem::mayAffect(), as long as they have a single
+  // predecessor, such that jump functions are only stored where the fact
+  // may change or control flow merges.
+  bool sparsePropagation = false;
+  // Hands the facts of all pending path edges to the same node at once to
+  // the normal flow functions, see FlowFunction::computeTargetsBatch(). Only
+  // takes effect if path edges are processed by a single thread.
+  bool batchFlowFunctions = false;
+  WorkListStrategy workListStrategy = WorkListStrategy::FIFO;
+  // Number of threads that process path edges concurrently in Phase I and
+  // compute the values of the nodes concurrently in Phase II. The flow and
+  // edge functions of the analysis problem must be thread-safe when using
+  // more than one thread.
+  unsigned numThreads = 1;
+  // Maximum number of compositions and joins of edge functions that are
+  // memoized by the IDESolver, 0 disables the memoization.
+  size_t edgeFunctionCacheSize = 65536;
+  // Maximum number of flow and edge functions of each kind, e.g. normal flow
+  // functions, that are cached by the solvers, 0 means no limit. The least
+  // recently used functions are evicted and constructed anew if needed.
+  size_t flowEdgeFunctionCacheSize = 0;
+  // Number of processed path edges after which the IDESolver drops the jump
+  // functions of methods that are finished, i.e. neither they nor any of
+  // their transitive callees have pending path edges. 0 disables the
+  // collection. Only takes effect if computeValues and followReturnsPastSeeds
+  // are disabled and path edges are processed by a single thread.
+  size_t jumpFunctionGCInterval = 0;
+  // Number of processed path edges after which an IDESolver that shares end
+  // summaries, see IDESolver::setSharedEndSummaries(), publishes the end
+  // summaries of the calling contexts of finished methods, in the sense of
+  // jumpFunctionGCInterval. 0 publishes them only once solving has finished.
+  // Only takes effect if path edges are processed by a single thread.
+  size_t endSummaryPublishInterval = 1000;
+  // Maximum number of jump functions the IDESolver keeps in memory, 0 means
+  // no limit. Once the limit is exceeded, the jump functions and end
+  // summaries of the least recently processed methods are spilled to a
+  // memory-mapped log and read back on demand. Only takes effect if path
+  // edges are processed by a single thread.
+  size_t maxInMemoryJumpFunctions = 0;
+  // Directory of the log that spilled jump functions and end summaries are
+  // written to, the system's temporary directory is used if empty.
+  std::string spillDirectory;
+  // Budgets of a single call to solve(), 0 means no limit: the number of
+  // path edges to process, the resident memory of the process in MB and the
+  // wall-clock time in seconds. Once a budget is exhausted, the solver stops
+  // processing path edges and computes the values of the facts reached so
+  // far, which hold but may be incomplete. Calling solve() again resumes.
+  size_t maxPathEdges = 0;
+  size_t maxResidentMemoryMB = 0;
+  size_t maxSolvingSeconds = 0;
+  // Interrupts solve() like an exhausted budget once cancelled. May be
+  // cancelled from any thread.
+  CancellationToken cancellationToken;
+  // File the solver state is saved to when solving is interrupted and every
+  // checkpointInterval processed path edges, 0 disables the periodic
+  // checkpoints. If the file exists when solve() is called first, the solver
+  // resumes from it. Requires the problem to support persisting facts and
+  // edge functions, see IFDSTabulationProblem::DtoKey(). Periodic
+  // checkpoints are only taken if path edges are processed by a single
+  // thread.
+  std::string checkpointFile;
+  size_t checkpointInterval = 0;
+  // File the end summaries of the analyzed methods are persisted in if
+  // computePersistedSummaries is enabled. If it exists, solve() imports the
+  // summaries of the methods whose IR and the IR of whose transitive callees
+  // are unchanged, and applies them at calls instead of analyzing the methods
+  // again; the nodes inside these methods have no results, and what the
+  // problem reports from their flow functions, e.g. the leaks of the
+  // IFDSTaintAnalysis, is not reported again. After solving, the summaries
+  // are exported to it, along with the imported ones of methods of other
+  // programs, such that the file may be shared by the analyses of several
+  // programs. A file that cannot be read, e.g. of an older version, is
+  // ignored and overwritten. Requires keys as for checkpointFile.
+  std::string persistedSummariesFile;
   friend std::ostream &operator<<(std::ostream &os,
                                   const SolverConfiguration &sc);
 };
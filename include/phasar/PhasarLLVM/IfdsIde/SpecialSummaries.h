@@ -115,7 +115,8 @@ public:
 
   std::shared_ptr<FlowFunction<D>>
   getSpecialFlowFunctionSummary(const std::string &name) {
-    return SpecialFlowFunctions[name];
+    auto Search = SpecialFlowFunctions.find(name);
+    return Search != SpecialFlowFunctions.end() ? Search->second : nullptr;
   }
 
   std::shared_ptr<EdgeFunction<V>>
@@ -125,7 +126,8 @@ public:
 
   std::shared_ptr<EdgeFunction<V>>
   getSpecialEdgeFunctionSummary(const std::string &name) {
-    return SpecialEdgeFunctions[name];
+    auto Search = SpecialEdgeFunctions.find(name);
+    return Search != SpecialEdgeFunctions.end() ? Search->second : nullptr;
   }
 
   friend std::ostream &operator<<(std::ostream &os,
@@ -18,11 +18,12 @@
 #define ANALYSIS_IFDS_IDE_ZEROEDFLOWFUNCTION_H_
 
 #include <phasar/PhasarLLVM/IfdsIde/FlowFunction.h>
+#include <map>
 #include <set>
 
 namespace psr {
 
-template <typename D> class ZeroedFlowFunction : public FlowFunction<D> {
+template <typename D> class ZeroedFlowFunction : public FFSetFlowFunction<D> {
 private:
   std::shared_ptr<FlowFunction<D>> delegate;
   D zerovalue;
@@ -30,15 +31,22 @@ private:
 public:
   ZeroedFlowFunction(std::shared_ptr<FlowFunction<D>> ff, D zv)
       : delegate(ff), zerovalue(zv) {}
-  std::set<D> computeTargets(D source) override {
+  FFSet<D> computeTargetSet(D source) override {
     if (source == zerovalue) {
-      std::set<D> result = delegate->computeTargets(source);
+      FFSet<D> result = delegate->computeTargetSet(source);
       result.insert(zerovalue);
       return result;
     } else {
-      return delegate->computeTargets(source);
+      return delegate->computeTargetSet(source);
     }
   }
+  std::map<D, FFSet<D>> computeTargetsBatch(const FFSet<D> &sources) override {
+    std::map<D, FFSet<D>> targets = delegate->computeTargetsBatch(sources);
+    if (sources.count(zerovalue)) {
+      targets[zerovalue].insert(zerovalue);
+    }
+    return targets;
+  }
 };
 } // namespace psr
 
@@ -22,6 +22,7 @@
 #include <llvm/IR/Instruction.h>
 #include <phasar/PhasarLLVM/Mono/IntraMonotoneProblem.h>
 #include <phasar/PhasarLLVM/Mono/Solver/IntraMonotoneSolver.h>
+#include <phasar/Utils/LLVMShorthands.h>
 
 namespace psr {
 
@@ -60,8 +61,7 @@ public:
     for (auto &entry :
          IntraMonotoneSolver<const llvm::Instruction *, D,
                              const llvm::Function *, C>::Analysis) {
-      std::cout << "Instruction:\n";
-      entry.first->print(llvm::outs());
+      std::cout << "Instruction:\n" << llvmIRToString(entry.first) << '\n';
       std::cout << "Facts:\n";
       if (entry.second.empty()) {
         std::cout << "\tEMPTY\n";
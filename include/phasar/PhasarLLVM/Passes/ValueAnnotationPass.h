@@ -17,6 +17,7 @@
 #ifndef ANALYSIS_VALUEANNOTATIONPASS_H_
 #define ANALYSIS_VALUEANNOTATIONPASS_H_
 
+#include <atomic>
 #include <iostream>
 #include <llvm/Analysis/LoopInfo.h>
 #include <llvm/IR/Function.h>
@@ -45,7 +46,8 @@ namespace psr {
  */
 class ValueAnnotationPass : public llvm::ModulePass {
 private:
-  static size_t unique_value_id;
+  // shared by all modules, such that the ids are unique within a project
+  static std::atomic<size_t> unique_value_id;
   llvm::LLVMContext &context;
 
 public:
@@ -0,0 +1,100 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef UTILS_BINARYIO_H_
+#define UTILS_BINARYIO_H_
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+
+namespace psr {
+
+/**
+ * Writes unsigned integers as variable-length LEB128 sequences and strings
+ * as their length followed by their bytes, such that small ids take a single
+ * byte. The format does not depend on the host's endianness or word size.
+ */
+class BinaryWriter {
+private:
+  std::ostream &OS;
+
+public:
+  explicit BinaryWriter(std::ostream &OS) : OS(OS) {}
+
+  void writeInt(uint64_t Value) {
+    do {
+      uint8_t Byte = Value & 0x7f;
+      Value >>= 7;
+      if (Value != 0) {
+        Byte |= 0x80;
+      }
+      OS.put(static_cast<char>(Byte));
+    } while (Value != 0);
+  }
+
+  void writeString(const std::string &Value) {
+    writeInt(Value.size());
+    OS.write(Value.data(), Value.size());
+  }
+
+  bool good() const { return OS.good(); }
+};
+
+/**
+ * Reads what a BinaryWriter has written. Throws a std::runtime_error if the
+ * input ends prematurely or is malformed.
+ */
+class BinaryReader {
+private:
+  std::istream &IS;
+
+public:
+  explicit BinaryReader(std::istream &IS) : IS(IS) {}
+
+  uint64_t readInt() {
+    uint64_t Value = 0;
+    for (unsigned Shift = 0; Shift < 64; Shift += 7) {
+      int Byte = IS.get();
+      if (Byte == std::char_traits<char>::eof()) {
+        throw std::runtime_error("BinaryReader: unexpected end of input");
+      }
+      Value |= static_cast<uint64_t>(Byte & 0x7f) << Shift;
+      if (!(Byte & 0x80)) {
+        return Value;
+      }
+    }
+    throw std::runtime_error("BinaryReader: malformed integer");
+  }
+
+  std::string readString() {
+    uint64_t Size = readInt();
+    std::string Value;
+    // grow with the data actually read rather than trusting the size
+    char Buffer[4096];
+    while (Size > 0) {
+      size_t Chunk = (Size < sizeof(Buffer)) ? Size : sizeof(Buffer);
+      if (!IS.read(Buffer, Chunk)) {
+        throw std::runtime_error("BinaryReader: unexpected end of input");
+      }
+      Value.append(Buffer, Chunk);
+      Size -= Chunk;
+    }
+    return Value;
+  }
+
+  /// Returns true if the whole input has been read.
+  bool atEnd() { return IS.peek() == std::char_traits<char>::eof(); }
+};
+
+} // namespace psr
+
+#endif /* UTILS_BINARYIO_H_ */
@@ -0,0 +1,139 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef UTILS_BITVECTORSET_H_
+#define UTILS_BITVECTORSET_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace psr {
+
+/**
+ * A set of dense ids, e.g. as handed out by an Interner, that is stored as a
+ * growable bit vector. Set operations work on whole 64-bit words at a time.
+ * The vector grows on demand, such that sets over universes of different
+ * sizes may be combined.
+ */
+class BitVectorSet {
+private:
+  static constexpr size_t WordBits = 64;
+  std::vector<uint64_t> Words;
+
+  static size_t wordIndex(uint32_t Id) { return Id / WordBits; }
+  static uint64_t bitMask(uint32_t Id) {
+    return uint64_t(1) << (Id % WordBits);
+  }
+
+public:
+  BitVectorSet() = default;
+  ~BitVectorSet() = default;
+
+  /// Returns true if the id has not been contained in the set before.
+  bool insert(uint32_t Id) {
+    size_t Idx = wordIndex(Id);
+    if (Idx >= Words.size()) {
+      Words.resize(Idx + 1, 0);
+    }
+    bool Inserted = !(Words[Idx] & bitMask(Id));
+    Words[Idx] |= bitMask(Id);
+    return Inserted;
+  }
+
+  void erase(uint32_t Id) {
+    size_t Idx = wordIndex(Id);
+    if (Idx < Words.size()) {
+      Words[Idx] &= ~bitMask(Id);
+    }
+  }
+
+  bool count(uint32_t Id) const {
+    size_t Idx = wordIndex(Id);
+    return Idx < Words.size() && (Words[Idx] & bitMask(Id));
+  }
+
+  bool empty() const {
+    return std::all_of(Words.begin(), Words.end(),
+                       [](uint64_t Word) { return Word == 0; });
+  }
+
+  size_t size() const {
+    size_t Size = 0;
+    for (uint64_t Word : Words) {
+      Size += __builtin_popcountll(Word);
+    }
+    return Size;
+  }
+
+  void clear() { Words.clear(); }
+
+  /**
+   * Adds all ids of Other to this set. Returns true if the set has changed.
+   * If Added is given, the ids that have not been contained in this set
+   * before are added to it as well.
+   */
+  bool unionWith(const BitVectorSet &Other, BitVectorSet *Added = nullptr) {
+    if (Other.Words.size() > Words.size()) {
+      Words.resize(Other.Words.size(), 0);
+    }
+    if (Added && Other.Words.size() > Added->Words.size()) {
+      Added->Words.resize(Other.Words.size(), 0);
+    }
+    bool Changed = false;
+    for (size_t I = 0; I < Other.Words.size(); ++I) {
+      uint64_t New = Other.Words[I] & ~Words[I];
+      if (New) {
+        Words[I] |= New;
+        if (Added) {
+          Added->Words[I] |= New;
+        }
+        Changed = true;
+      }
+    }
+    return Changed;
+  }
+
+  /// Removes all ids of Other from this set.
+  void subtract(const BitVectorSet &Other) {
+    size_t Len = std::min(Words.size(), Other.Words.size());
+    for (size_t I = 0; I < Len; ++I) {
+      Words[I] &= ~Other.Words[I];
+    }
+  }
+
+  /// Calls Fn for every id in the set in ascending order.
+  template <typename Fn> void forEach(Fn F) const {
+    for (size_t I = 0; I < Words.size(); ++I) {
+      uint64_t Word = Words[I];
+      while (Word) {
+        F(static_cast<uint32_t>(I * WordBits + __builtin_ctzll(Word)));
+        Word &= Word - 1;
+      }
+    }
+  }
+
+  friend bool operator==(const BitVectorSet &Lhs, const BitVectorSet &Rhs) {
+    const std::vector<uint64_t> &Short =
+        (Lhs.Words.size() <= Rhs.Words.size()) ? Lhs.Words : Rhs.Words;
+    const std::vector<uint64_t> &Long =
+        (Lhs.Words.size() <= Rhs.Words.size()) ? Rhs.Words : Lhs.Words;
+    return std::equal(Short.begin(), Short.end(), Long.begin()) &&
+           std::all_of(Long.begin() + Short.size(), Long.end(),
+                       [](uint64_t Word) { return Word == 0; });
+  }
+
+  friend bool operator!=(const BitVectorSet &Lhs, const BitVectorSet &Rhs) {
+    return !(Lhs == Rhs);
+  }
+};
+
+} // namespace psr
+
+#endif /* UTILS_BITVECTORSET_H_ */
@@ -0,0 +1,43 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef UTILS_CANCELLATIONTOKEN_H_
+#define UTILS_CANCELLATIONTOKEN_H_
+
+#include <atomic>
+#include <memory>
+
+namespace psr {
+
+/**
+ * A flag through which one thread asks a long-running computation on
+ * another thread to stop. Copies of a token share the flag, such that a
+ * token can be handed to the computation by value and cancelled through
+ * the copy that has been kept.
+ */
+class CancellationToken {
+private:
+  std::shared_ptr<std::atomic<bool>> Cancelled;
+
+public:
+  CancellationToken() : Cancelled(std::make_shared<std::atomic<bool>>(false)) {}
+
+  void cancel() { Cancelled->store(true, std::memory_order_relaxed); }
+
+  bool isCancelled() const {
+    return Cancelled->load(std::memory_order_relaxed);
+  }
+
+  /// Withdraws the request, such that the computation may be resumed.
+  void reset() { Cancelled->store(false, std::memory_order_relaxed); }
+};
+
+} // namespace psr
+
+#endif /* UTILS_CANCELLATIONTOKEN_H_ */
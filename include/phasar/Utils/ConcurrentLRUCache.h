@@ -0,0 +1,146 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef UTILS_CONCURRENTLRUCACHE_H_
+#define UTILS_CONCURRENTLRUCACHE_H_
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace psr {
+
+/**
+ * A hash-based cache that is partitioned into shards that are guarded by
+ * mutexes of their own, such that threads looking up different keys rarely
+ * contend. Each shard holds at most MaxSize / NumShards entries and evicts
+ * its least recently used entry once it is full, a MaxSize of 0 means no
+ * limit. The numbers of hits, misses and evictions are recorded.
+ *
+ * Values are computed outside of the locks, hence, a value may be computed
+ * more than once if several threads miss the same key at the same time. All
+ * of them obtain the value that has been inserted first.
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class ConcurrentLRUCache {
+private:
+  using Entry = std::pair<Key, Value>;
+  using EntryList = std::list<Entry>;
+
+  struct KeyRefHash {
+    size_t operator()(const Key *K) const { return Hash()(*K); }
+  };
+
+  struct KeyRefEqual {
+    bool operator()(const Key *Lhs, const Key *Rhs) const {
+      return *Lhs == *Rhs;
+    }
+  };
+
+  struct Shard {
+    std::mutex Mutex;
+    // most recently used entries first, list nodes never move
+    EntryList Entries;
+    std::unordered_map<const Key *, typename EntryList::iterator, KeyRefHash,
+                       KeyRefEqual>
+        Index;
+  };
+
+  std::vector<std::unique_ptr<Shard>> Shards;
+  size_t MaxShardSize;
+  std::atomic<size_t> Hits;
+  std::atomic<size_t> Misses;
+  std::atomic<size_t> Evictions;
+
+  Shard &getShard(size_t H) const {
+    // pointer hashes are multiples of the alignment, mix the higher bits in
+    H ^= H >> 4;
+    H ^= H >> 12;
+    return *Shards[H % Shards.size()];
+  }
+
+public:
+  explicit ConcurrentLRUCache(size_t MaxSize = 0, size_t NumShards = 1)
+      : Hits(0), Misses(0), Evictions(0) {
+    NumShards = std::max<size_t>(NumShards, 1);
+    for (size_t I = 0; I < NumShards; ++I) {
+      Shards.push_back(std::make_unique<Shard>());
+    }
+    MaxShardSize =
+        (MaxSize == 0) ? 0 : std::max<size_t>(MaxSize / NumShards, 1);
+  }
+
+  ConcurrentLRUCache(const ConcurrentLRUCache &) = delete;
+  ConcurrentLRUCache &operator=(const ConcurrentLRUCache &) = delete;
+
+  /// Returns the value cached for K, computes it by Compute() and caches it
+  /// if there is none.
+  template <typename Fn> Value getOrCompute(const Key &K, Fn Compute) {
+    Shard &S = getShard(Hash()(K));
+    {
+      std::lock_guard<std::mutex> Lock(S.Mutex);
+      auto Search = S.Index.find(&K);
+      if (Search != S.Index.end()) {
+        ++Hits;
+        S.Entries.splice(S.Entries.begin(), S.Entries, Search->second);
+        return Search->second->second;
+      }
+    }
+    ++Misses;
+    Value Result = Compute();
+    std::lock_guard<std::mutex> Lock(S.Mutex);
+    auto Search = S.Index.find(&K);
+    if (Search != S.Index.end()) {
+      return Search->second->second;
+    }
+    if (MaxShardSize != 0 && S.Entries.size() >= MaxShardSize) {
+      S.Index.erase(&S.Entries.back().first);
+      S.Entries.pop_back();
+      ++Evictions;
+    }
+    S.Entries.emplace_front(K, Result);
+    S.Index.emplace(&S.Entries.front().first, S.Entries.begin());
+    return Result;
+  }
+
+  /// Forgets all cached values, the statistics are kept.
+  void clear() {
+    for (auto &S : Shards) {
+      std::lock_guard<std::mutex> Lock(S->Mutex);
+      S->Index.clear();
+      S->Entries.clear();
+    }
+  }
+
+  /// Returns the number of cached values.
+  size_t size() const {
+    size_t Size = 0;
+    for (auto &S : Shards) {
+      std::lock_guard<std::mutex> Lock(S->Mutex);
+      Size += S->Entries.size();
+    }
+    return Size;
+  }
+
+  size_t getHits() const { return Hits; }
+
+  size_t getMisses() const { return Misses; }
+
+  size_t getEvictions() const { return Evictions; }
+};
+
+} // namespace psr
+
+#endif /* UTILS_CONCURRENTLRUCACHE_H_ */
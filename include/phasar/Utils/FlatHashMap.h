@@ -0,0 +1,168 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef UTILS_FLATHASHMAP_H_
+#define UTILS_FLATHASHMAP_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace psr {
+
+/**
+ * A hash map that stores its entries inline in a single array and resolves
+ * collisions by linear probing. It is meant for small, cheaply copyable keys
+ * and values such as ids, where the per-entry allocations of
+ * std::unordered_map dominate the memory consumption.
+ *
+ * Erasing uses backward shifting rather than tombstones, such that lookups
+ * never degrade. Inserting and erasing invalidate all pointers into the map.
+ */
+template <typename K, typename V, typename Hash = std::hash<K>>
+class FlatHashMap {
+private:
+  struct Slot {
+    K Key;
+    V Value;
+  };
+  std::vector<Slot> Slots;
+  std::vector<uint8_t> Used;
+  size_t Size = 0;
+  unsigned Shift = 64;
+
+  // Fibonacci hashing spreads identity hashes of dense ids over the table.
+  size_t home(const K &Key) const {
+    return static_cast<size_t>(
+        (static_cast<uint64_t>(Hash()(Key)) * 0x9E3779B97F4A7C15ull) >> Shift);
+  }
+
+  size_t mask() const { return Slots.size() - 1; }
+
+  size_t findSlot(const K &Key) const {
+    if (Size == 0) {
+      return Slots.size();
+    }
+    for (size_t I = home(Key);; I = (I + 1) & mask()) {
+      if (!Used[I]) {
+        return Slots.size();
+      }
+      if (Slots[I].Key == Key) {
+        return I;
+      }
+    }
+  }
+
+  void rehash(size_t NewCapacity) {
+    std::vector<Slot> OldSlots(NewCapacity);
+    std::vector<uint8_t> OldUsed(NewCapacity, 0);
+    OldSlots.swap(Slots);
+    OldUsed.swap(Used);
+    Shift = 64;
+    for (size_t C = NewCapacity; C > 1; C >>= 1) {
+      --Shift;
+    }
+    for (size_t I = 0; I < OldSlots.size(); ++I) {
+      if (OldUsed[I]) {
+        size_t J = home(OldSlots[I].Key);
+        while (Used[J]) {
+          J = (J + 1) & mask();
+        }
+        Slots[J] = OldSlots[I];
+        Used[J] = 1;
+      }
+    }
+  }
+
+public:
+  FlatHashMap() = default;
+
+  /// Returns a pointer to the value of Key, or nullptr if there is none.
+  V *find(const K &Key) {
+    size_t I = findSlot(Key);
+    return (I < Slots.size()) ? &Slots[I].Value : nullptr;
+  }
+
+  const V *find(const K &Key) const {
+    size_t I = findSlot(Key);
+    return (I < Slots.size()) ? &Slots[I].Value : nullptr;
+  }
+
+  bool count(const K &Key) const { return findSlot(Key) < Slots.size(); }
+
+  /**
+   * Inserts Value for Key unless Key is present already. Returns a pointer to
+   * the value stored for Key and whether it has been inserted.
+   */
+  std::pair<V *, bool> insert(const K &Key, const V &Value) {
+    // keep the load factor below 3/4
+    if ((Size + 1) * 4 > Slots.size() * 3) {
+      rehash(Slots.empty() ? 8 : Slots.size() * 2);
+    }
+    size_t I = home(Key);
+    for (; Used[I]; I = (I + 1) & mask()) {
+      if (Slots[I].Key == Key) {
+        return {&Slots[I].Value, false};
+      }
+    }
+    Slots[I].Key = Key;
+    Slots[I].Value = Value;
+    Used[I] = 1;
+    ++Size;
+    return {&Slots[I].Value, true};
+  }
+
+  /// Removes Key and returns whether it has been present.
+  bool erase(const K &Key) {
+    size_t I = findSlot(Key);
+    if (I == Slots.size()) {
+      return false;
+    }
+    Used[I] = 0;
+    --Size;
+    // move the following entries of the probe sequence into the gap unless
+    // that would place them before their home slot
+    for (size_t J = (I + 1) & mask(); Used[J]; J = (J + 1) & mask()) {
+      size_t H = home(Slots[J].Key);
+      if (((J - H) & mask()) >= ((J - I) & mask())) {
+        Slots[I] = Slots[J];
+        Used[I] = 1;
+        Used[J] = 0;
+        I = J;
+      }
+    }
+    return true;
+  }
+
+  /// Calls F(Key, Value) for every entry in unspecified order.
+  template <typename Fn> void forEach(Fn F) const {
+    for (size_t I = 0; I < Slots.size(); ++I) {
+      if (Used[I]) {
+        F(Slots[I].Key, Slots[I].Value);
+      }
+    }
+  }
+
+  size_t size() const { return Size; }
+
+  bool empty() const { return Size == 0; }
+
+  void clear() {
+    Slots.clear();
+    Used.clear();
+    Size = 0;
+    Shift = 64;
+  }
+};
+
+} // namespace psr
+
+#endif /* UTILS_FLATHASHMAP_H_ */
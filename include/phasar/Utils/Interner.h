@@ -0,0 +1,147 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef UTILS_INTERNER_H_
+#define UTILS_INTERNER_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+namespace psr {
+
+/**
+ * Maps objects to dense 32-bit ids in the order in which they are seen for
+ * the first time, and back.
+ *
+ * The interner may be used from multiple threads. The mapping from objects to
+ * ids is partitioned into shards that are guarded by mutexes of their own.
+ * The mapping from ids back to objects is stored in blocks that never move,
+ * hence, get() does not require any locking.
+ */
+template <typename T> class Interner {
+public:
+  using IdType = uint32_t;
+  static constexpr IdType InvalidId = UINT32_MAX;
+
+private:
+  static constexpr size_t BlockBits = 16;
+  static constexpr size_t BlockSize = size_t(1) << BlockBits;
+  static constexpr size_t NumBlocks = size_t(1) << (32 - BlockBits);
+
+  struct Shard {
+    std::mutex Mutex;
+    std::unordered_map<T, IdType> Ids;
+  };
+  std::vector<std::unique_ptr<Shard>> Shards;
+  // the keys of the shards' maps are never moved, we thus refer to them
+  std::unique_ptr<std::atomic<const T **>[]> Blocks;
+  std::mutex BlockMutex;
+  std::atomic<IdType> NextId;
+
+  Shard &getShard(const T &Obj) const {
+    size_t H = std::hash<T>()(Obj);
+    H ^= H >> 4;
+    H ^= H >> 12;
+    return *Shards[H % Shards.size()];
+  }
+
+  void setObject(IdType Id, const T *Obj) {
+    std::atomic<const T **> &Block = Blocks[Id >> BlockBits];
+    if (!Block.load(std::memory_order_acquire)) {
+      std::lock_guard<std::mutex> Lock(BlockMutex);
+      if (!Block.load(std::memory_order_relaxed)) {
+        Block.store(new const T *[BlockSize], std::memory_order_release);
+      }
+    }
+    Block.load(std::memory_order_acquire)[Id & (BlockSize - 1)] = Obj;
+  }
+
+public:
+  explicit Interner(size_t NumShards = 1)
+      : Blocks(new std::atomic<const T **>[NumBlocks]), NextId(0) {
+    for (size_t I = 0; I < std::max<size_t>(NumShards, 1); ++I) {
+      Shards.push_back(std::make_unique<Shard>());
+    }
+    for (size_t I = 0; I < NumBlocks; ++I) {
+      Blocks[I].store(nullptr, std::memory_order_relaxed);
+    }
+  }
+
+  ~Interner() {
+    for (size_t I = 0; I < NumBlocks; ++I) {
+      delete[] Blocks[I].load(std::memory_order_relaxed);
+    }
+  }
+
+  Interner(const Interner &) = delete;
+  Interner &operator=(const Interner &) = delete;
+
+  /// Returns the id of the given object, assigns a fresh one if required.
+  IdType getOrCreateId(const T &Obj) {
+    Shard &S = getShard(Obj);
+    std::lock_guard<std::mutex> Lock(S.Mutex);
+    auto Search = S.Ids.find(Obj);
+    if (Search != S.Ids.end()) {
+      return Search->second;
+    }
+    IdType Id = NextId++;
+    if (Id == InvalidId) {
+      throw std::length_error("Interner: ran out of 32-bit ids");
+    }
+    auto Inserted = S.Ids.emplace(Obj, Id).first;
+    setObject(Id, &Inserted->first);
+    return Id;
+  }
+
+  /// Returns the id of the given object or InvalidId if it has never been
+  /// seen before.
+  IdType getId(const T &Obj) const {
+    Shard &S = getShard(Obj);
+    std::lock_guard<std::mutex> Lock(S.Mutex);
+    auto Search = S.Ids.find(Obj);
+    return (Search != S.Ids.end()) ? Search->second : InvalidId;
+  }
+
+  /// Returns the object of the given id. The id must have been handed out by
+  /// this interner.
+  const T &get(IdType Id) const {
+    return *Blocks[Id >> BlockBits].load(
+        std::memory_order_acquire)[Id & (BlockSize - 1)];
+  }
+
+  /// Returns the number of ids handed out so far.
+  size_t size() const { return NextId; }
+};
+
+template <typename T>
+constexpr typename Interner<T>::IdType Interner<T>::InvalidId;
+
+/// Packs two 32-bit ids into a single 64-bit key.
+inline uint64_t packIds(uint32_t First, uint32_t Second) {
+  return (static_cast<uint64_t>(First) << 32) | Second;
+}
+
+inline uint32_t unpackFirstId(uint64_t Key) {
+  return static_cast<uint32_t>(Key >> 32);
+}
+
+inline uint32_t unpackSecondId(uint64_t Key) {
+  return static_cast<uint32_t>(Key);
+}
+
+} // namespace psr
+
+#endif /* UTILS_INTERNER_H_ */
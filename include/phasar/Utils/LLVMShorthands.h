@@ -28,8 +28,10 @@
 #include <llvm/IR/Instructions.h>
 #include <llvm/IR/Value.h>
 #include <llvm/Support/raw_ostream.h>
+#include <map>
 #include <phasar/Config/Configuration.h>
 #include <phasar/PhasarLLVM/IfdsIde/LLVMZeroValue.h>
+#include <string>
 #include <vector>
 
 namespace psr {
@@ -142,6 +144,47 @@ std::size_t computeModuleHash(llvm::Module *M, bool considerIdentifier);
  */
 std::size_t computeModuleHash(const llvm::Module *M);
 
+/**
+ * @brief Computes a hash value for a given LLVM Function.
+ * @note Metadata attachments and the numbering of metadata nodes are not
+ * considered, such that the hash does not change if another function of the
+ * module is changed. The hash may serve to detect the functions whose
+ * analysis results have to be invalidated after the IR changed.
+ * @param F LLVM Function.
+ * @return Hash value.
+ */
+std::size_t computeFunctionHash(const llvm::Function *F);
+
+/**
+ * @brief Computes the hash values of all functions defined in a given LLVM
+ * Module.
+ * @param M LLVM Module.
+ * @return Mapping from function names to hash values.
+ */
+std::map<std::string, std::size_t>
+computeFunctionHashes(const llvm::Module *M);
+
+/**
+ * @brief Returns a key that identifies the given LLVM Value across runs on the
+ * same IR, such that data-flow facts can be persisted.
+ * @note Supported are the zero value, global values, function arguments and
+ * instructions; the latter two are identified by their function's name and
+ * their position in it.
+ * @param V LLVM Value.
+ * @return Key of the value, throws a std::runtime_error for other values.
+ */
+std::string getValueKey(const llvm::Value *V);
+
+/**
+ * @brief Returns the LLVM Value identified by a key of getValueKey().
+ * @param M LLVM Module containing the value.
+ * @param Key Key of the value.
+ * @return LLVM Value, throws a std::runtime_error if the module does not
+ * contain it.
+ */
+const llvm::Value *getValueFromKey(const llvm::Module *M,
+                                   const std::string &Key);
+
 } // namespace psr
 
 #endif /* SRC_LIB_LLVMSHORTHANDS_HH_ */
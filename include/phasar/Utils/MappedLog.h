@@ -0,0 +1,122 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef UTILS_MAPPEDLOG_H_
+#define UTILS_MAPPEDLOG_H_
+
+#include <algorithm>
+#include <cstdlib>
+#include <fcntl.h>
+#include <stdexcept>
+#include <string>
+#include <sys/mman.h>
+#include <type_traits>
+#include <unistd.h>
+#include <vector>
+
+namespace psr {
+
+/**
+ * An append-only sequence of trivially copyable records that lives in a
+ * memory-mapped temporary file rather than on the heap. The operating system
+ * pages the records in and out as needed, hence the log may grow far beyond
+ * the available memory. The file is removed as soon as it has been created
+ * and vanishes with the log.
+ *
+ * Appending may remap the file, which invalidates all pointers into the log.
+ * The log is not thread-safe.
+ */
+template <typename T> class MappedLog {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "MappedLog requires trivially copyable records");
+
+private:
+  int FD = -1;
+  T *Data = nullptr;
+  size_t Size = 0;
+  size_t Capacity = 0;
+
+  void grow(size_t MinCapacity) {
+    size_t NewCapacity =
+        std::max<size_t>({MinCapacity, Capacity * 2, 4096 / sizeof(T) + 1});
+    if (ftruncate(FD, NewCapacity * sizeof(T)) != 0) {
+      throw std::runtime_error("MappedLog: could not grow the log file");
+    }
+    if (Data) {
+      munmap(Data, Capacity * sizeof(T));
+      Data = nullptr;
+    }
+    void *P = mmap(nullptr, NewCapacity * sizeof(T), PROT_READ | PROT_WRITE,
+                   MAP_SHARED, FD, 0);
+    if (P == MAP_FAILED) {
+      throw std::runtime_error("MappedLog: could not map the log file");
+    }
+    Data = static_cast<T *>(P);
+    Capacity = NewCapacity;
+  }
+
+public:
+  /**
+   * Creates the log in the given directory, or in the system's temporary
+   * directory if Directory is empty.
+   */
+  explicit MappedLog(std::string Directory = "") {
+    if (Directory.empty()) {
+      const char *TmpDir = std::getenv("TMPDIR");
+      Directory = TmpDir ? TmpDir : "/tmp";
+    }
+    std::string Template = Directory + "/phasar-log-XXXXXX";
+    std::vector<char> Path(Template.begin(), Template.end());
+    Path.push_back('\0');
+    FD = mkstemp(Path.data());
+    if (FD < 0) {
+      throw std::runtime_error("MappedLog: could not create a log file in " +
+                               Directory);
+    }
+    unlink(Path.data());
+  }
+
+  ~MappedLog() {
+    if (Data) {
+      munmap(Data, Capacity * sizeof(T));
+    }
+    if (FD >= 0) {
+      close(FD);
+    }
+  }
+
+  MappedLog(const MappedLog &) = delete;
+  MappedLog &operator=(const MappedLog &) = delete;
+
+  /// Appends Count records and returns the index of the first one.
+  size_t append(const T *Records, size_t Count) {
+    if (Size + Count > Capacity) {
+      grow(Size + Count);
+    }
+    std::copy(Records, Records + Count, Data + Size);
+    size_t Begin = Size;
+    Size += Count;
+    return Begin;
+  }
+
+  size_t append(const T &Record) { return append(&Record, 1); }
+
+  const T &operator[](size_t Index) const { return Data[Index]; }
+
+  /// Returns a pointer to the record at Index, valid until the next append.
+  const T *data(size_t Index) const { return Data + Index; }
+
+  size_t size() const { return Size; }
+
+  bool empty() const { return Size == 0; }
+};
+
+} // namespace psr
+
+#endif /* UTILS_MAPPEDLOG_H_ */
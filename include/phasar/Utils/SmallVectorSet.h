@@ -0,0 +1,154 @@
+/******************************************************************************
+ * Copyright (c) 2017 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef UTILS_SMALLVECTORSET_H_
+#define UTILS_SMALLVECTORSET_H_
+
+#include <algorithm>
+#include <boost/container/small_vector.hpp>
+#include <cstddef>
+#include <initializer_list>
+#include <utility>
+
+namespace psr {
+
+/**
+ * A set that stores up to InlineSize elements inside the object itself and
+ * only allocates if it grows beyond, such that the few elements it usually
+ * holds do not cost a heap allocation each, as they do in a std::set. Up to
+ * LinearLimit elements are kept in insertion order and looked up linearly.
+ * Larger sets are kept sorted by operator< and looked up by binary search,
+ * hence, the elements are reordered once the set grows beyond LinearLimit.
+ */
+template <typename T, unsigned InlineSize> class SmallVectorSet {
+private:
+  using Container = boost::container::small_vector<T, InlineSize>;
+  Container Elements;
+
+  // sizes up to which the elements are unordered and looked up linearly
+  static constexpr size_t LinearLimit = 32;
+
+  bool isSorted() const { return Elements.size() > LinearLimit; }
+
+public:
+  using value_type = T;
+  using size_type = size_t;
+  using const_iterator = typename Container::const_iterator;
+  using iterator = const_iterator;
+
+  SmallVectorSet() = default;
+
+  SmallVectorSet(std::initializer_list<T> Init) {
+    insert(Init.begin(), Init.end());
+  }
+
+  template <typename InputIt> SmallVectorSet(InputIt First, InputIt Last) {
+    insert(First, Last);
+  }
+
+  /// Inserts Value unless it is present already. Returns an iterator to the
+  /// element equal to Value and whether it has been inserted.
+  std::pair<const_iterator, bool> insert(const T &Value) {
+    if (isSorted()) {
+      auto Pos = std::lower_bound(Elements.begin(), Elements.end(), Value);
+      if (Pos != Elements.end() && !(Value < *Pos)) {
+        return {Pos, false};
+      }
+      return {Elements.insert(Pos, Value), true};
+    }
+    auto Search = find(Value);
+    if (Search != end()) {
+      return {Search, false};
+    }
+    Elements.push_back(Value);
+    if (isSorted()) {
+      std::sort(Elements.begin(), Elements.end());
+      return {std::lower_bound(Elements.begin(), Elements.end(), Value), true};
+    }
+    return {end() - 1, true};
+  }
+
+  template <typename InputIt> void insert(InputIt First, InputIt Last) {
+    for (; First != Last && Elements.size() < LinearLimit; ++First) {
+      insert(*First);
+    }
+    if (First == Last) {
+      return;
+    }
+    bool WasSorted = isSorted();
+    size_t OldSize = Elements.size();
+    Elements.insert(Elements.end(), First, Last);
+    if (WasSorted) {
+      std::sort(Elements.begin() + OldSize, Elements.end());
+      std::inplace_merge(Elements.begin(), Elements.begin() + OldSize,
+                         Elements.end());
+    } else {
+      std::sort(Elements.begin(), Elements.end());
+    }
+    Elements.erase(std::unique(Elements.begin(), Elements.end()),
+                   Elements.end());
+  }
+
+  void insert(std::initializer_list<T> Init) {
+    insert(Init.begin(), Init.end());
+  }
+
+  /// Removes Value and returns the number of removed elements.
+  size_t erase(const T &Value) {
+    auto Search = find(Value);
+    if (Search == end()) {
+      return 0;
+    }
+    Elements.erase(Search);
+    return 1;
+  }
+
+  const_iterator find(const T &Value) const {
+    if (isSorted()) {
+      auto Pos = std::lower_bound(Elements.begin(), Elements.end(), Value);
+      return Pos != Elements.end() && !(Value < *Pos) ? Pos : end();
+    }
+    return std::find(Elements.begin(), Elements.end(), Value);
+  }
+
+  size_t count(const T &Value) const { return find(Value) != end(); }
+
+  const_iterator begin() const { return Elements.begin(); }
+
+  const_iterator end() const { return Elements.end(); }
+
+  size_t size() const { return Elements.size(); }
+
+  bool empty() const { return Elements.empty(); }
+
+  void clear() { Elements.clear(); }
+
+  void reserve(size_t Capacity) { Elements.reserve(Capacity); }
+
+  /// Compares the elements regardless of their order.
+  friend bool operator==(const SmallVectorSet &Lhs, const SmallVectorSet &Rhs) {
+    if (Lhs.size() != Rhs.size()) {
+      return false;
+    }
+    for (const T &Value : Lhs) {
+      if (!Rhs.count(Value)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  friend bool operator!=(const SmallVectorSet &Lhs, const SmallVectorSet &Rhs) {
+    return !(Lhs == Rhs);
+  }
+};
+
+} // namespace psr
+
+#endif /* UTILS_SMALLVECTORSET_H_ */
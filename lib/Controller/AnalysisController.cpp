@@ -24,6 +24,135 @@ std::ostream &operator<<(std::ostream &os, const ExportType &E) {
   return os << ExportTypeToString.at(E);
 }
 
+static void printLeaks(
+    const map<const llvm::Instruction *, set<const llvm::Value *>> &Leaks) {
+  auto &lg = lg::get();
+  BOOST_LOG_SEV(lg, INFO) << "Found the following leaks:";
+  if (Leaks.empty()) {
+    BOOST_LOG_SEV(lg, INFO) << "No leaks found!";
+  } else {
+    for (auto Leak : Leaks) {
+      string ModuleName = getModuleFromVal(Leak.first)->getModuleIdentifier();
+      BOOST_LOG_SEV(lg, INFO)
+          << "At instruction: '" << llvmIRToString(Leak.first)
+          << "' in file: '" << ModuleName << "'";
+      for (auto LeakValue : Leak.second) {
+        BOOST_LOG_SEV(lg, INFO) << llvmIRToString(LeakValue);
+      }
+    }
+  }
+}
+
+static void writeImmutableMemoryLocations(
+    ProjectIRDB &IRDB, IFDSConstAnalysis &constproblem,
+    function<set<const llvm::Value *>(const llvm::Instruction *)> ResultsAt) {
+  PAMM_FACTORY;
+  auto &lg = lg::get();
+  constproblem.printInitMemoryLocations();
+  REG_COUNTER_WITH_VALUE("Const Init Set Size",
+                         constproblem.initMemoryLocationCount());
+  constproblem.printInitMemoryLocations();
+  START_TIMER("DFA Result Computation");
+  // TODO need to consider object fields, i.e. getelementptr instructions
+  // get all stack and heap alloca instructions
+  std::set<const llvm::Value *> allMemoryLoc = IRDB.getAllocaInstructions();
+  std::set<std::string> IgnoredGlobalNames = {"llvm.used",
+                                              "llvm.compiler.used",
+                                              "llvm.global_ctors",
+                                              "llvm.global_dtors",
+                                              "vtable",
+                                              "typeinfo"};
+  // add global varibales to the memory location set, except the llvm
+  // intrinsic global variables
+  for (auto M : IRDB.getAllModules()) {
+    for (auto &GV : M->globals()) {
+      if (GV.hasName()) {
+        string GVName = cxx_demangle(GV.getName().str());
+        if (!IgnoredGlobalNames.count(GVName.substr(0, GVName.find(' ')))) {
+          allMemoryLoc.insert(&GV);
+        }
+      }
+    }
+  }
+  BOOST_LOG_SEV(lg, DEBUG) << "-------------";
+  BOOST_LOG_SEV(lg, DEBUG) << "Allocation Instructions:";
+  for (auto memloc : allMemoryLoc) {
+    BOOST_LOG_SEV(lg, DEBUG) << llvmIRToString(memloc);
+  }
+  BOOST_LOG_SEV(lg, DEBUG) << "-------------";
+  BOOST_LOG_SEV(lg, DEBUG)
+      << "Printing return/resume instruction + dataflow facts:";
+  for (auto RR : IRDB.getRetResInstructions()) {
+    std::set<const llvm::Value *> facts = ResultsAt(RR);
+    // Empty facts means the return/resume statement is part of not
+    // analyzed function - remove all allocas of that function
+    if (facts.empty()) {
+      const llvm::Function *F = RR->getParent()->getParent();
+      for (auto mem_itr = allMemoryLoc.begin();
+           mem_itr != allMemoryLoc.end();) {
+        if (auto Inst = llvm::dyn_cast<llvm::Instruction>(*mem_itr)) {
+          if (Inst->getParent()->getParent() == F) {
+            mem_itr = allMemoryLoc.erase(mem_itr);
+          } else {
+            ++mem_itr;
+          }
+        } else {
+          ++mem_itr;
+        }
+      }
+    } else {
+      BOOST_LOG_SEV(lg, DEBUG) << "Instruction: " << llvmIRToString(RR);
+      for (auto fact : facts) {
+        if (isAllocaInstOrHeapAllocaFunction(fact) ||
+            llvm::isa<llvm::GlobalValue>(fact)) {
+          BOOST_LOG_SEV(lg, DEBUG)
+              << "   Fact: " << constproblem.DtoString(fact);
+          // remove allocas that are mutable, i.e. are valid facts
+          allMemoryLoc.erase(fact);
+        }
+      }
+    }
+  }
+  // write immutable locations to file
+  bfs::path cfp(VariablesMap["config"].as<string>());
+  // reduce the config path to just the filename - no path and no extension
+  std::string config = cfp.filename().string();
+  std::size_t extensionPos = config.find(cfp.extension().string());
+  config.replace(extensionPos, cfp.extension().size(), "");
+  ofstream ResultFile;
+  ResultFile.open(config + "_memlocs.txt");
+  // BOOST_LOG_SEV(lg, INFO) << "-------------";
+  // BOOST_LOG_SEV(lg, INFO) << "Immutable Stack/Heap Memory";
+  for (auto memloc : allMemoryLoc) {
+    if (auto memlocInst = llvm::dyn_cast<llvm::Instruction>(memloc)) {
+      ResultFile << llvmIRToString(memlocInst) << " in function "
+                 << memlocInst->getParent()->getParent()->getName().str()
+                 << "\n";
+    } else {
+      ResultFile << llvmIRToString(memloc) << '\n';
+    }
+  }
+  ResultFile.close();
+  STOP_TIMER("DFA Result Computation");
+  BOOST_LOG_SEV(lg, INFO) << "-------------";
+}
+
+template <typename ProblemTy>
+static unique_ptr<MultiEntryPointSolver<
+    ProblemTy, LLVMIFDSSolver<const llvm::Value *, LLVMBasedICFG &>>>
+solveEntryPointGroups(LLVMBasedICFG &ICFG,
+                      const vector<vector<string>> &EntryPointGroups,
+                      unsigned NumThreads) {
+  auto Solver = make_unique<MultiEntryPointSolver<
+      ProblemTy, LLVMIFDSSolver<const llvm::Value *, LLVMBasedICFG &>>>(
+      [&](const vector<string> &EntryPoints) {
+        return make_unique<ProblemTy>(ICFG, EntryPoints);
+      },
+      EntryPointGroups, NumThreads);
+  Solver->solve();
+  return Solver;
+}
+
 AnalysisController::AnalysisController(
     ProjectIRDB &&IRDB, std::vector<DataFlowAnalysisType> Analyses,
     bool WPA_MODE, bool PrintEdgeRecorder, std::string graph_id)
@@ -143,36 +272,167 @@ AnalysisController::AnalysisController(
     // CFG is only needed for intra-procedural monotone framework
     LLVMBasedCFG CFG;
     /*
-     * Perform all the analysis that the user has chosen.
+     * Solve the chosen IFDS analyses that share the data-flow domain in a
+     * single pass if the user asked for it.
      */
-    for (DataFlowAnalysisType analysis : Analyses) {
+    vector<DataFlowAnalysisType> FusedAnalyses;
+    if (VariablesMap.count("fuse_analyses") &&
+        VariablesMap["fuse_analyses"].as<bool>()) {
+      for (DataFlowAnalysisType analysis : Analyses) {
+        switch (analysis) {
+        case DataFlowAnalysisType::IFDS_TaintAnalysis:
+        case DataFlowAnalysisType::IFDS_TypeAnalysis:
+        case DataFlowAnalysisType::IFDS_UninitializedVariables:
+        case DataFlowAnalysisType::IFDS_ConstAnalysis:
+        case DataFlowAnalysisType::IFDS_SolverTest:
+          FusedAnalyses.push_back(analysis);
+          break;
+        default:
+          break;
+        }
+      }
+      if (FusedAnalyses.size() < 2) {
+        FusedAnalyses.clear();
+      }
+    }
+    if (!FusedAnalyses.empty()) {
+      using LLVMIFDSProblem =
+          IFDSTabulationProblem<const llvm::Instruction *, const llvm::Value *,
+                                const llvm::Function *, LLVMBasedICFG &>;
+      vector<unique_ptr<LLVMIFDSProblem>> Problems;
+      for (DataFlowAnalysisType analysis : FusedAnalyses) {
+        BOOST_LOG_SEV(lg, INFO) << "Performing fused analysis: " << analysis;
+        switch (analysis) {
+        case DataFlowAnalysisType::IFDS_TaintAnalysis:
+          Problems.push_back(make_unique<IFDSTaintAnalysis>(ICFG, EntryPoints));
+          break;
+        case DataFlowAnalysisType::IFDS_TypeAnalysis:
+          Problems.push_back(make_unique<IFDSTypeAnalysis>(ICFG, EntryPoints));
+          break;
+        case DataFlowAnalysisType::IFDS_UninitializedVariables:
+          Problems.push_back(
+              make_unique<IFDSUnitializedVariables>(ICFG, EntryPoints));
+          break;
+        case DataFlowAnalysisType::IFDS_ConstAnalysis:
+          Problems.push_back(make_unique<IFDSConstAnalysis>(ICFG, EntryPoints));
+          break;
+        default:
+          Problems.push_back(make_unique<IFDSSolverTest>(ICFG, EntryPoints));
+          break;
+        }
+      }
+      vector<LLVMIFDSProblem *> ProblemRefs;
+      for (auto &Problem : Problems) {
+        ProblemRefs.push_back(Problem.get());
+      }
+      START_TIMER("Fused DFA Runtime");
+      IFDSProductProblem<const llvm::Instruction *, const llvm::Value *,
+                         const llvm::Function *, LLVMBasedICFG &>
+          productproblem(ProblemRefs);
+      LLVMIFDSSolver<TaggedFact<const llvm::Value *>, LLVMBasedICFG &>
+          llvmproductsolver(productproblem, true);
+      llvmproductsolver.solve();
+      FinalResultsJson += llvmproductsolver.getAsJson();
+      for (unsigned K = 0; K < FusedAnalyses.size(); ++K) {
+        if (FusedAnalyses[K] == DataFlowAnalysisType::IFDS_TaintAnalysis) {
+          printLeaks(static_cast<IFDSTaintAnalysis &>(*Problems[K]).Leaks);
+        } else if (FusedAnalyses[K] ==
+                   DataFlowAnalysisType::IFDS_ConstAnalysis) {
+          writeImmutableMemoryLocations(
+              IRDB, static_cast<IFDSConstAnalysis &>(*Problems[K]),
+              [&](const llvm::Instruction *I) {
+                return productproblem.factsOf(
+                    K, llvmproductsolver.ifdsResultsAt(I));
+              });
+        }
+      }
+      STOP_TIMER("Fused DFA Runtime");
+    }
+    unsigned AnalysisThreads =
+        VariablesMap.count("analysis_threads")
+            ? VariablesMap["analysis_threads"].as<unsigned>()
+            : 1;
+    // the groups of entry points of an analysis run on threads of their own,
+    // i.e. up to AnalysisThreads * EntryPointThreads threads in total
+    unsigned EntryPointThreads =
+        VariablesMap.count("entry_point_threads")
+            ? VariablesMap["entry_point_threads"].as<unsigned>()
+            : 1;
+#ifdef PERFORMANCE_EVA
+    if (AnalysisThreads > 1 || EntryPointThreads > 1) {
+      // the performance measurements cannot tell concurrent analyses apart
+      BOOST_LOG_SEV(lg, WARNING)
+          << "Running the analyses sequentially, as PAMM is enabled";
+      AnalysisThreads = 1;
+      EntryPointThreads = 1;
+    }
+#endif
+    /*
+     * Split the entry points into groups that are solved by solver instances
+     * of their own if the user asked for it.
+     */
+    vector<vector<string>> EntryPointGroups;
+    unsigned GroupSize = VariablesMap.count("entry_point_groups")
+                             ? VariablesMap["entry_point_groups"].as<unsigned>()
+                             : 0;
+    if (GroupSize > 0) {
+      for (size_t Idx = 0; Idx < EntryPoints.size(); Idx += GroupSize) {
+        EntryPointGroups.emplace_back(
+            EntryPoints.begin() + Idx,
+            EntryPoints.begin() + min<size_t>(Idx + GroupSize,
+                                              EntryPoints.size()));
+      }
+    }
+    /*
+     * Perform all the analysis that the user has chosen. Each analysis only
+     * reads the IRDB, the type hierarchy and the ICFG and writes its results
+     * to its own JSON value, hence, the analyses may run concurrently.
+     */
+    auto RunAnalysis = [&](DataFlowAnalysisType analysis, json &Results) {
       BOOST_LOG_SEV(lg, INFO) << "Performing analysis: " << analysis;
-      START_TIMER("DFA Runtime");
+      if (EntryPointGroups.size() > 1) {
+        switch (analysis) {
+        case DataFlowAnalysisType::IFDS_TaintAnalysis: {
+          auto Solver = solveEntryPointGroups<IFDSTaintAnalysis>(
+              ICFG, EntryPointGroups, EntryPointThreads);
+          Results += Solver->getAsJson();
+          map<const llvm::Instruction *, set<const llvm::Value *>> Leaks;
+          for (size_t K = 0; K < Solver->size(); ++K) {
+            for (auto &Leak : Solver->getProblem(K).Leaks) {
+              Leaks[Leak.first].insert(Leak.second.begin(), Leak.second.end());
+            }
+          }
+          printLeaks(Leaks);
+          return;
+        }
+        case DataFlowAnalysisType::IFDS_TypeAnalysis:
+          Results += solveEntryPointGroups<IFDSTypeAnalysis>(
+                         ICFG, EntryPointGroups, EntryPointThreads)
+                         ->getAsJson();
+          return;
+        case DataFlowAnalysisType::IFDS_UninitializedVariables:
+          Results += solveEntryPointGroups<IFDSUnitializedVariables>(
+                         ICFG, EntryPointGroups, EntryPointThreads)
+                         ->getAsJson();
+          return;
+        case DataFlowAnalysisType::IFDS_SolverTest:
+          Results += solveEntryPointGroups<IFDSSolverTest>(
+                         ICFG, EntryPointGroups, EntryPointThreads)
+                         ->getAsJson();
+          return;
+        default:
+          // the other analyses solve all entry points together
+          break;
+        }
+      }
       switch (analysis) {
       case DataFlowAnalysisType::IFDS_TaintAnalysis: {
         IFDSTaintAnalysis taintanalysisproblem(ICFG, EntryPoints);
         LLVMIFDSSolver<const llvm::Value *, LLVMBasedICFG &> llvmtaintsolver(
             taintanalysisproblem, true);
         llvmtaintsolver.solve();
-        FinalResultsJson += llvmtaintsolver.getAsJson();
-        // Here we can get the leaks
-        map<const llvm::Instruction *, set<const llvm::Value *>> Leaks =
-            taintanalysisproblem.Leaks;
-        BOOST_LOG_SEV(lg, INFO) << "Found the following leaks:";
-        if (Leaks.empty()) {
-          BOOST_LOG_SEV(lg, INFO) << "No leaks found!";
-        } else {
-          for (auto Leak : Leaks) {
-            string ModuleName =
-                getModuleFromVal(Leak.first)->getModuleIdentifier();
-            BOOST_LOG_SEV(lg, INFO)
-                << "At instruction: '" << llvmIRToString(Leak.first)
-                << "' in file: '" << ModuleName << "'";
-            for (auto LeakValue : Leak.second) {
-              BOOST_LOG_SEV(lg, INFO) << llvmIRToString(LeakValue);
-            }
-          }
-        }
+        Results += llvmtaintsolver.getAsJson();
+        printLeaks(taintanalysisproblem.Leaks);
         break;
       }
       case DataFlowAnalysisType::IDE_TaintAnalysis: {
@@ -180,7 +440,7 @@ AnalysisController::AnalysisController(
         LLVMIDESolver<const llvm::Value *, const llvm::Value *, LLVMBasedICFG &>
             llvmtaintsolver(taintanalysisproblem, true);
         llvmtaintsolver.solve();
-        FinalResultsJson += llvmtaintsolver.getAsJson();
+        Results += llvmtaintsolver.getAsJson();
         break;
       }
       case DataFlowAnalysisType::IDE_TypeStateAnalysis: {
@@ -188,7 +448,7 @@ AnalysisController::AnalysisController(
         LLVMIDESolver<const llvm::Value *, State, LLVMBasedICFG &>
             llvmtypestatesolver(typestateproblem, true);
         llvmtypestatesolver.solve();
-        FinalResultsJson += llvmtypestatesolver.getAsJson();
+        Results += llvmtypestatesolver.getAsJson();
         break;
       }
       case DataFlowAnalysisType::IFDS_TypeAnalysis: {
@@ -196,7 +456,7 @@ AnalysisController::AnalysisController(
         LLVMIFDSSolver<const llvm::Value *, LLVMBasedICFG &> llvmtypesolver(
             typeanalysisproblem, true);
         llvmtypesolver.solve();
-        FinalResultsJson += llvmtypesolver.getAsJson();
+        Results += llvmtypesolver.getAsJson();
         break;
       }
       case DataFlowAnalysisType::IFDS_UninitializedVariables: {
@@ -204,7 +464,7 @@ AnalysisController::AnalysisController(
         LLVMIFDSSolver<const llvm::Value *, LLVMBasedICFG &> llvmunivsolver(
             uninitializedvarproblem, true);
         llvmunivsolver.solve();
-        FinalResultsJson += llvmunivsolver.getAsJson();
+        Results += llvmunivsolver.getAsJson();
         if (PrintEdgeRecorder) {
           llvmunivsolver.exportJSONDataModel(graph_id);
         }
@@ -215,7 +475,7 @@ AnalysisController::AnalysisController(
         LLVMIFDSSolver<LCAPair, LLVMBasedICFG &> llvmlcasolver(lcaproblem,
                                                                true);
         llvmlcasolver.solve();
-        FinalResultsJson += llvmlcasolver.getAsJson();
+        Results += llvmlcasolver.getAsJson();
         if (PrintEdgeRecorder) {
           llvmlcasolver.exportJSONDataModel(graph_id);
         }
@@ -226,7 +486,7 @@ AnalysisController::AnalysisController(
         LLVMIDESolver<const llvm::Value *, int, LLVMBasedICFG &> llvmlcasolver(
             lcaproblem, true);
         llvmlcasolver.solve();
-        FinalResultsJson += llvmlcasolver.getAsJson();
+        Results += llvmlcasolver.getAsJson();
         break;
       }
       case DataFlowAnalysisType::IFDS_ConstAnalysis: {
@@ -234,98 +494,11 @@ AnalysisController::AnalysisController(
         LLVMIFDSSolver<const llvm::Value *, LLVMBasedICFG &> llvmconstsolver(
             constproblem, true);
         llvmconstsolver.solve();
-        FinalResultsJson += llvmconstsolver.getAsJson();
-        constproblem.printInitMemoryLocations();
-        REG_COUNTER_WITH_VALUE("Const Init Set Size",
-                               constproblem.initMemoryLocationCount());
-        constproblem.printInitMemoryLocations();
-        START_TIMER("DFA Result Computation");
-        // TODO need to consider object fields, i.e. getelementptr instructions
-        // get all stack and heap alloca instructions
-        std::set<const llvm::Value *> allMemoryLoc =
-            IRDB.getAllocaInstructions();
-        std::set<std::string> IgnoredGlobalNames = {"llvm.used",
-                                                    "llvm.compiler.used",
-                                                    "llvm.global_ctors",
-                                                    "llvm.global_dtors",
-                                                    "vtable",
-                                                    "typeinfo"};
-        // add global varibales to the memory location set, except the llvm
-        // intrinsic global variables
-        for (auto M : IRDB.getAllModules()) {
-          for (auto &GV : M->globals()) {
-            if (GV.hasName()) {
-              string GVName = cxx_demangle(GV.getName().str());
-              if (!IgnoredGlobalNames.count(
-                      GVName.substr(0, GVName.find(' ')))) {
-                allMemoryLoc.insert(&GV);
-              }
-            }
-          }
-        }
-        BOOST_LOG_SEV(lg, DEBUG) << "-------------";
-        BOOST_LOG_SEV(lg, DEBUG) << "Allocation Instructions:";
-        for (auto memloc : allMemoryLoc) {
-          BOOST_LOG_SEV(lg, DEBUG) << llvmIRToString(memloc);
-        }
-        BOOST_LOG_SEV(lg, DEBUG) << "-------------";
-        BOOST_LOG_SEV(lg, DEBUG)
-            << "Printing return/resume instruction + dataflow facts:";
-        for (auto RR : IRDB.getRetResInstructions()) {
-          std::set<const llvm::Value *> facts =
-              llvmconstsolver.ifdsResultsAt(RR);
-          // Empty facts means the return/resume statement is part of not
-          // analyzed function - remove all allocas of that function
-          if (facts.empty()) {
-            const llvm::Function *F = RR->getParent()->getParent();
-            for (auto mem_itr = allMemoryLoc.begin();
-                 mem_itr != allMemoryLoc.end();) {
-              if (auto Inst = llvm::dyn_cast<llvm::Instruction>(*mem_itr)) {
-                if (Inst->getParent()->getParent() == F) {
-                  mem_itr = allMemoryLoc.erase(mem_itr);
-                } else {
-                  ++mem_itr;
-                }
-              } else {
-                ++mem_itr;
-              }
-            }
-          } else {
-            BOOST_LOG_SEV(lg, DEBUG) << "Instruction: " << llvmIRToString(RR);
-            for (auto fact : facts) {
-              if (isAllocaInstOrHeapAllocaFunction(fact) ||
-                  llvm::isa<llvm::GlobalValue>(fact)) {
-                BOOST_LOG_SEV(lg, DEBUG)
-                    << "   Fact: " << constproblem.DtoString(fact);
-                // remove allocas that are mutable, i.e. are valid facts
-                allMemoryLoc.erase(fact);
-              }
-            }
-          }
-        }
-        // write immutable locations to file
-        bfs::path cfp(VariablesMap["config"].as<string>());
-        // reduce the config path to just the filename - no path and no
-        // extension
-        std::string config = cfp.filename().string();
-        std::size_t extensionPos = config.find(cfp.extension().string());
-        config.replace(extensionPos, cfp.extension().size(), "");
-        ofstream ResultFile;
-        ResultFile.open(config + "_memlocs.txt");
-        // BOOST_LOG_SEV(lg, INFO) << "-------------";
-        // BOOST_LOG_SEV(lg, INFO) << "Immutable Stack/Heap Memory";
-        for (auto memloc : allMemoryLoc) {
-          if (auto memlocInst = llvm::dyn_cast<llvm::Instruction>(memloc)) {
-            ResultFile << llvmIRToString(memlocInst) << " in function "
-                       << memlocInst->getParent()->getParent()->getName().str()
-                       << "\n";
-          } else {
-            ResultFile << llvmIRToString(memloc) << '\n';
-          }
-        }
-        ResultFile.close();
-        STOP_TIMER("DFA Result Computation");
-        BOOST_LOG_SEV(lg, INFO) << "-------------";
+        Results += llvmconstsolver.getAsJson();
+        writeImmutableMemoryLocations(
+            IRDB, constproblem, [&](const llvm::Instruction *I) {
+              return llvmconstsolver.ifdsResultsAt(I);
+            });
         break;
       }
       case DataFlowAnalysisType::IFDS_SolverTest: {
@@ -333,7 +506,7 @@ AnalysisController::AnalysisController(
         LLVMIFDSSolver<const llvm::Value *, LLVMBasedICFG &> llvmifdstestsolver(
             ifdstest, true);
         llvmifdstestsolver.solve();
-        FinalResultsJson += llvmifdstestsolver.getAsJson();
+        Results += llvmifdstestsolver.getAsJson();
         break;
       }
       case DataFlowAnalysisType::IDE_SolverTest: {
@@ -373,7 +546,7 @@ AnalysisController::AnalysisController(
             VariablesMap["analysis_plugin"].as<vector<string>>();
 #ifdef PHASAR_PLUGINS_ENABLED
         AnalysisPluginController PluginController(
-            AnalysisPlugins, ICFG, EntryPoints, FinalResultsJson);
+            AnalysisPlugins, ICFG, EntryPoints, Results);
 #endif
         break;
       }
@@ -384,7 +557,52 @@ AnalysisController::AnalysisController(
         BOOST_LOG_SEV(lg, CRITICAL) << "The analysis it not valid";
         break;
       }
+    };
+    vector<DataFlowAnalysisType> RemainingAnalyses;
+    for (DataFlowAnalysisType analysis : Analyses) {
+      if (find(FusedAnalyses.begin(), FusedAnalyses.end(), analysis) ==
+          FusedAnalyses.end()) {
+        RemainingAnalyses.push_back(analysis);
+      }
+    }
+    if (AnalysisThreads > 1 && RemainingAnalyses.size() > 1) {
+      START_TIMER("DFA Runtime");
+      vector<json> Results(RemainingAnalyses.size());
+      vector<exception_ptr> Errors(RemainingAnalyses.size());
+      atomic<size_t> NextAnalysis(0);
+      vector<thread> Workers;
+      for (size_t T = 0;
+           T < min<size_t>(AnalysisThreads, RemainingAnalyses.size()); ++T) {
+        Workers.emplace_back([&]() {
+          for (size_t Idx = NextAnalysis++; Idx < RemainingAnalyses.size();
+               Idx = NextAnalysis++) {
+            try {
+              RunAnalysis(RemainingAnalyses[Idx], Results[Idx]);
+            } catch (...) {
+              Errors[Idx] = current_exception();
+            }
+          }
+        });
+      }
+      for (auto &Worker : Workers) {
+        Worker.join();
+      }
       STOP_TIMER("DFA Runtime");
+      // add the results in the order in which the analyses have been chosen
+      for (size_t Idx = 0; Idx < RemainingAnalyses.size(); ++Idx) {
+        if (Errors[Idx]) {
+          rethrow_exception(Errors[Idx]);
+        }
+        for (auto &Result : Results[Idx]) {
+          FinalResultsJson += Result;
+        }
+      }
+    } else {
+      for (DataFlowAnalysisType analysis : RemainingAnalyses) {
+        START_TIMER("DFA Runtime");
+        RunAnalysis(analysis, FinalResultsJson);
+        STOP_TIMER("DFA Runtime");
+      }
     }
   }
   // Perform module-wise (MW) analysis
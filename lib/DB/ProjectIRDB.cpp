@@ -430,14 +430,16 @@ bool ProjectIRDB::containsSourceFile(const std::string &src) {
 }
 
 llvm::LLVMContext *ProjectIRDB::getLLVMContext(const std::string &name) {
-  if (contexts.count(name))
-    return contexts[name].get();
+  auto Search = contexts.find(name);
+  if (Search != contexts.end())
+    return Search->second.get();
   return nullptr;
 }
 
 llvm::Module *ProjectIRDB::getModule(const std::string &name) {
-  if (modules.count(name))
-    return modules[name].get();
+  auto Search = modules.find(name);
+  if (Search != modules.end())
+    return Search->second.get();
   return nullptr;
 }
 
@@ -452,29 +454,33 @@ std::set<llvm::Module *> ProjectIRDB::getAllModules() const {
 std::size_t ProjectIRDB::getNumberOfModules() { return modules.size(); }
 
 llvm::Module *ProjectIRDB::getModuleDefiningFunction(const std::string &name) {
-  if (functions.count(name)) {
-    return modules[functions[name]].get();
+  auto Search = functions.find(name);
+  if (Search != functions.end()) {
+    return modules.at(Search->second).get();
   }
   return nullptr;
 }
 
 llvm::Function *ProjectIRDB::getFunction(const std::string &name) {
-  if (functions.count(name))
-    return modules[functions[name]]->getFunction(name);
+  auto Search = functions.find(name);
+  if (Search != functions.end())
+    return modules.at(Search->second)->getFunction(name);
   return nullptr;
 }
 
 llvm::GlobalVariable *ProjectIRDB::getGlobalVariable(const std::string &name) {
-  if (globals.count(name))
-    return modules[globals[name]]->getGlobalVariable(name);
+  auto Search = globals.find(name);
+  if (Search != globals.end())
+    return modules.at(Search->second)->getGlobalVariable(name);
   return nullptr;
 }
 
 std::set<std::string> ProjectIRDB::getAllSourceFiles() { return source_files; }
 
 llvm::Instruction *ProjectIRDB::getInstruction(std::size_t id) {
-  if (instructions.count(id))
-    return instructions[id];
+  auto Search = instructions.find(id);
+  if (Search != instructions.end())
+    return Search->second;
   return nullptr;
 }
 
@@ -488,8 +494,9 @@ std::size_t ProjectIRDB::getInstructionID(const llvm::Instruction *I) {
 }
 
 PointsToGraph *ProjectIRDB::getPointsToGraph(const std::string &name) {
-  if (ptgs.count(name))
-    return ptgs[name].get();
+  auto Search = ptgs.find(name);
+  if (Search != ptgs.end())
+    return Search->second.get();
   return nullptr;
 }
 
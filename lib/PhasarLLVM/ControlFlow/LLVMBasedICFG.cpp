@@ -678,9 +678,13 @@ LLVMBasedICFG::getCalleesOfCallAt(const llvm::Instruction *n) {
     llvm::ImmutableCallSite CS(n);
     set<const llvm::Function *> Callees;
     string CallerName = CS->getFunction()->getName().str();
+    // the lookup must not insert, the call graph is queried concurrently
+    auto Caller = function_vertex_map.find(CallerName);
+    if (Caller == function_vertex_map.end()) {
+      return Callees;
+    }
     out_edge_iterator ei, ei_end;
-    for (boost::tie(ei, ei_end) =
-             boost::out_edges(function_vertex_map[CallerName], cg);
+    for (boost::tie(ei, ei_end) = boost::out_edges(Caller->second, cg);
          ei != ei_end; ++ei) {
       auto source = boost::source(*ei, cg);
       auto edge = cg[*ei];
@@ -711,9 +715,12 @@ LLVMBasedICFG::getCalleesOfCallAt(const llvm::Instruction *n) {
 set<const llvm::Instruction *>
 LLVMBasedICFG::getCallersOf(const llvm::Function *m) {
   set<const llvm::Instruction *> CallersOf;
+  auto Callee = function_vertex_map.find(m->getName().str());
+  if (Callee == function_vertex_map.end()) {
+    return CallersOf;
+  }
   in_edge_iterator ei, ei_end;
-  for (boost::tie(ei, ei_end) =
-           boost::in_edges(function_vertex_map[m->getName().str()], cg);
+  for (boost::tie(ei, ei_end) = boost::in_edges(Callee->second, cg);
        ei != ei_end; ++ei) {
     auto source = boost::source(*ei, cg);
     auto edge = cg[*ei];
@@ -18,7 +18,6 @@
 #include <phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h>
 #include <phasar/PhasarLLVM/IfdsIde/FlowFunction.h>
 #include <phasar/PhasarLLVM/IfdsIde/FlowFunctions/Gen.h>
-#include <phasar/PhasarLLVM/IfdsIde/FlowFunctions/GenAll.h>
 #include <phasar/PhasarLLVM/IfdsIde/FlowFunctions/Identity.h>
 #include <phasar/PhasarLLVM/IfdsIde/FlowFunctions/Kill.h>
 #include <phasar/PhasarLLVM/IfdsIde/FlowFunctions/KillAll.h>
@@ -32,7 +31,7 @@ namespace psr {
 
 IFDSConstAnalysis::IFDSConstAnalysis(IFDSConstAnalysis::i_t icfg,
                                      vector<string> EntryPoints)
-    : DefaultIFDSTabulationProblem(icfg), ptg(icfg.getWholeModulePTG()),
+    : IFDSGenKillProblem(icfg), ptg(icfg.getWholeModulePTG()),
       EntryPoints(EntryPoints) {
   PAMM_FACTORY;
   REG_HISTOGRAM("Context-relevant-PT");
@@ -40,11 +39,11 @@ IFDSConstAnalysis::IFDSConstAnalysis(IFDSConstAnalysis::i_t icfg,
   IFDSConstAnalysis::zerovalue = createZeroValue();
 }
 
-shared_ptr<FlowFunction<IFDSConstAnalysis::d_t>>
-IFDSConstAnalysis::getNormalFlowFunction(IFDSConstAnalysis::n_t curr,
-                                         IFDSConstAnalysis::n_t succ) {
+set<IFDSConstAnalysis::d_t>
+IFDSConstAnalysis::getNormalGen(IFDSConstAnalysis::n_t curr,
+                                IFDSConstAnalysis::n_t succ) {
   auto &lg = lg::get();
-  BOOST_LOG_SEV(lg, DEBUG) << "IFDSConstAnalysis::getNormalFlowFunction()";
+  BOOST_LOG_SEV(lg, DEBUG) << "IFDSConstAnalysis::getNormalGen()";
   // Check all store instructions.
   if (const llvm::StoreInst *Store = llvm::dyn_cast<llvm::StoreInst>(curr)) {
     // If the store instruction sets up or updates the vtable, i.e. value
@@ -70,7 +69,7 @@ IFDSConstAnalysis::getNormalFlowFunction(IFDSConstAnalysis::n_t curr,
                   string::npos) {
             BOOST_LOG_SEV(lg, DEBUG)
                 << "Store Instruction sets up or updates vtable - ignored!";
-            return Identity<IFDSConstAnalysis::d_t>::getInstance();
+            return {};
           }
         }
       }
@@ -90,12 +89,7 @@ IFDSConstAnalysis::getNormalFlowFunction(IFDSConstAnalysis::n_t curr,
       if (isInitialized(alias)) {
         BOOST_LOG_SEV(lg, DEBUG) << "Compute context-relevant points-to "
                                     "information for the pointer operand.";
-        return make_shared<
-            GenAll<IFDSConstAnalysis::d_t>>(/*pointsToSet*/
-                                            getContextRelevantPointsToSet(
-                                                pointsToSet,
-                                                curr->getFunction()),
-                                            zeroValue());
+        return getContextRelevantPointsToSet(pointsToSet, curr->getFunction());
       }
     }
     // If neither the pointer operand nor one of its alias is initialized,
@@ -107,7 +101,14 @@ IFDSConstAnalysis::getNormalFlowFunction(IFDSConstAnalysis::n_t curr,
   } /* end store instruction */
 
   // Pass everything else as identity
-  return Identity<IFDSConstAnalysis::d_t>::getInstance();
+  return {};
+}
+
+set<IFDSConstAnalysis::d_t>
+IFDSConstAnalysis::getNormalKill(IFDSConstAnalysis::n_t curr,
+                                 IFDSConstAnalysis::n_t succ) {
+  // Memory locations never become immutable again
+  return {};
 }
 
 shared_ptr<FlowFunction<IFDSConstAnalysis::d_t>>
@@ -166,12 +167,12 @@ IFDSConstAnalysis::getRetFlowFunction(IFDSConstAnalysis::n_t callSite,
   // All other data-flow facts of the callee function are killed at this point
 }
 
-shared_ptr<FlowFunction<IFDSConstAnalysis::d_t>>
-IFDSConstAnalysis::getCallToRetFlowFunction(
-    IFDSConstAnalysis::n_t callSite, IFDSConstAnalysis::n_t retSite,
-    set<IFDSConstAnalysis::m_t> callees) {
+set<IFDSConstAnalysis::d_t>
+IFDSConstAnalysis::getCallToRetGen(IFDSConstAnalysis::n_t callSite,
+                                   IFDSConstAnalysis::n_t retSite,
+                                   set<IFDSConstAnalysis::m_t> callees) {
   auto &lg = lg::get();
-  BOOST_LOG_SEV(lg, DEBUG) << "IFDSConstAnalysis::getCallToRetFlowFunction()";
+  BOOST_LOG_SEV(lg, DEBUG) << "IFDSConstAnalysis::getCallToRetGen()";
   BOOST_LOG_SEV(lg, DEBUG) << "Call site: " << llvmIRToString(callSite);
   BOOST_LOG_SEV(lg, DEBUG) << "Return site: " << llvmIRToString(retSite);
   // Process the effects of a llvm memory intrinsic function.
@@ -184,12 +185,8 @@ IFDSConstAnalysis::getCallToRetFlowFunction(
       if (isInitialized(alias)) {
         BOOST_LOG_SEV(lg, DEBUG) << "Compute context-relevant points-to "
                                     "information of the pointer operand.";
-        return make_shared<
-            GenAll<IFDSConstAnalysis::d_t>>(/*pointsToSet*/
-                                            getContextRelevantPointsToSet(
-                                                pointsToSet,
-                                                callSite->getFunction()),
-                                            zeroValue());
+        return getContextRelevantPointsToSet(pointsToSet,
+                                             callSite->getFunction());
       }
     }
     markAsInitialized(pointerOp);
@@ -197,7 +194,14 @@ IFDSConstAnalysis::getCallToRetFlowFunction(
   }
 
   // Pass everything else as identity
-  return Identity<IFDSConstAnalysis::d_t>::getInstance();
+  return {};
+}
+
+set<IFDSConstAnalysis::d_t>
+IFDSConstAnalysis::getCallToRetKill(IFDSConstAnalysis::n_t callSite,
+                                    IFDSConstAnalysis::n_t retSite,
+                                    set<IFDSConstAnalysis::m_t> callees) {
+  return {};
 }
 
 shared_ptr<FlowFunction<IFDSConstAnalysis::d_t>>
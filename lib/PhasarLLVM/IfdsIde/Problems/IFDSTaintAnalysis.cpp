@@ -14,6 +14,7 @@
 #include <llvm/IR/LLVMContext.h>
 #include <llvm/IR/Type.h>
 #include <llvm/IR/Value.h>
+#include <mutex>
 #include <phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h>
 #include <phasar/PhasarLLVM/IfdsIde/FlowFunction.h>
 #include <phasar/PhasarLLVM/IfdsIde/FlowFunctions/Gen.h>
@@ -94,7 +95,8 @@ IFDSTaintAnalysis::getNormalFlowFunction(IFDSTaintAnalysis::n_t curr,
     set<IFDSTaintAnalysis::d_t> CmdArgs;
     for (auto &Arg : curr->getFunction()->args()) {
       CmdArgs.insert(&Arg);
-      Arg.print(llvm::outs());
+      BOOST_LOG_SEV(lg, DEBUG)
+          << "Tainted command-line argument: " << llvmIRToString(&Arg);
     }
     return make_shared<GenAll<IFDSTaintAnalysis::d_t>>(CmdArgs, zeroValue());
   }
@@ -115,6 +117,24 @@ IFDSTaintAnalysis::getNormalFlowFunction(IFDSTaintAnalysis::n_t curr,
           return {source};
         }
       }
+      map<IFDSTaintAnalysis::d_t, FFSet<IFDSTaintAnalysis::d_t>>
+      computeTargetsBatch(
+          const FFSet<IFDSTaintAnalysis::d_t> &sources) override {
+        // inspect the store once for all facts
+        const llvm::Value *ValueOp = store->getValueOperand();
+        const llvm::Value *PointerOp = store->getPointerOperand();
+        map<IFDSTaintAnalysis::d_t, FFSet<IFDSTaintAnalysis::d_t>> targets;
+        for (IFDSTaintAnalysis::d_t source : sources) {
+          if (source == ValueOp) {
+            targets[source] = {PointerOp, source};
+          } else if (source != PointerOp) {
+            targets[source] = {source};
+          } else {
+            targets[source];
+          }
+        }
+        return targets;
+      }
     };
     return make_shared<TAFF>(Store);
   }
@@ -136,6 +156,25 @@ IFDSTaintAnalysis::getNormalFlowFunction(IFDSTaintAnalysis::n_t curr,
   return Identity<IFDSTaintAnalysis::d_t>::getInstance();
 }
 
+bool IFDSTaintAnalysis::mayAffect(IFDSTaintAnalysis::n_t curr,
+                                  IFDSTaintAnalysis::d_t d) {
+  // Only the command-line arguments and stores, loads and GEPs of tainted
+  // values change the taints, see getNormalFlowFunction()
+  if (curr->getFunction()->getName().str() == "main" &&
+      icfg.isStartPoint(curr)) {
+    return true;
+  }
+  if (llvm::isa<llvm::StoreInst>(curr) || llvm::isa<llvm::LoadInst>(curr) ||
+      llvm::isa<llvm::GetElementPtrInst>(curr)) {
+    for (auto &Op : curr->operands()) {
+      if (Op.get() == d) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
 shared_ptr<FlowFunction<IFDSTaintAnalysis::d_t>>
 IFDSTaintAnalysis::getCallFlowFunction(IFDSTaintAnalysis::n_t callStmt,
                                        IFDSTaintAnalysis::m_t destMthd) {
@@ -216,13 +255,14 @@ IFDSTaintAnalysis::getCallToRetFlowFunction(
         IFDSTaintAnalysis::m_t calledMthd;
         SinkFunction sink;
         map<IFDSTaintAnalysis::n_t, set<IFDSTaintAnalysis::d_t>> &Leaks;
+        mutex &LeaksMutex;
         const IFDSTaintAnalysis *taintanalysis;
         TAFF(llvm::ImmutableCallSite cs, IFDSTaintAnalysis::m_t calledMthd,
              SinkFunction s,
              map<IFDSTaintAnalysis::n_t, set<IFDSTaintAnalysis::d_t>> &leaks,
-             const IFDSTaintAnalysis *ta)
+             mutex &leaksMutex, const IFDSTaintAnalysis *ta)
             : callSite(cs), calledMthd(calledMthd), sink(s), Leaks(leaks),
-              taintanalysis(ta) {}
+              LeaksMutex(leaksMutex), taintanalysis(ta) {}
         set<IFDSTaintAnalysis::d_t>
         computeTargets(IFDSTaintAnalysis::d_t source) {
           // check if a tainted value flows into a sink
@@ -233,6 +273,7 @@ IFDSTaintAnalysis::getCallToRetFlowFunction(
                   (find(sink.sinkargs.begin(), sink.sinkargs.end(), idx) !=
                    sink.sinkargs.end())) {
                 cout << "FOUND LEAK" << endl;
+                lock_guard<mutex> lock(LeaksMutex);
                 Leaks[callSite.getInstruction()].insert(source);
               }
             }
@@ -241,7 +282,8 @@ IFDSTaintAnalysis::getCallToRetFlowFunction(
         }
       };
       return make_shared<TAFF>(llvm::ImmutableCallSite(callSite), Callee,
-                               Sinks.at(FunctionName), Leaks, this);
+                               Sinks.at(FunctionName), Leaks, LeaksMutex,
+                               this);
     }
   }
   // Otherwise pass everything as it is
@@ -294,6 +336,15 @@ string IFDSTaintAnalysis::DtoString(IFDSTaintAnalysis::d_t d) const {
   return llvmIRToString(d);
 }
 
+string IFDSTaintAnalysis::DtoKey(IFDSTaintAnalysis::d_t d) const {
+  return getValueKey(d);
+}
+
+IFDSTaintAnalysis::d_t IFDSTaintAnalysis::KeytoD(const string &key) {
+  return getValueFromKey(icfg.getMethod(EntryPoints.front())->getParent(),
+                         key);
+}
+
 string IFDSTaintAnalysis::NtoString(IFDSTaintAnalysis::n_t n) const {
   return llvmIRToString(n);
 }
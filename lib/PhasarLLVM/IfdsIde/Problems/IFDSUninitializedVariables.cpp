@@ -47,7 +47,7 @@ IFDSUnitializedVariables::getNormalFlowFunction(
   // set every local variable as uninitialized, that is not a function parameter
   if (curr->getFunction()->getName().str() == "main" &&
       icfg.isStartPoint(curr)) {
-    curr->print(llvm::outs());
+    BOOST_LOG_SEV(lg, DEBUG) << "Entry of main: " << llvmIRToString(curr);
     const llvm::Function *func = icfg.getMethodOf(curr);
 
     // set all locals as uninitialized flow function
@@ -179,6 +179,24 @@ IFDSUnitializedVariables::getNormalFlowFunction(
   return Identity<IFDSUnitializedVariables::d_t>::getInstance();
 }
 
+bool IFDSUnitializedVariables::mayAffect(IFDSUnitializedVariables::n_t curr,
+                                         IFDSUnitializedVariables::d_t d) {
+  // the start of main and stores may change any fact, other instructions
+  // only those they use or if they use an undefined value, see
+  // getNormalFlowFunction()
+  if ((curr->getFunction()->getName().str() == "main" &&
+       icfg.isStartPoint(curr)) ||
+      llvm::isa<llvm::StoreInst>(curr)) {
+    return true;
+  }
+  for (auto &operand : curr->operands()) {
+    if (operand == d || llvm::isa<llvm::UndefValue>(operand)) {
+      return true;
+    }
+  }
+  return false;
+}
+
 shared_ptr<FlowFunction<IFDSUnitializedVariables::d_t>>
 IFDSUnitializedVariables::getCallFlowFunction(
     IFDSUnitializedVariables::n_t callStmt,
@@ -390,6 +408,17 @@ IFDSUnitializedVariables::DtoString(IFDSUnitializedVariables::d_t d) const {
   return llvmIRToString(d);
 }
 
+string
+IFDSUnitializedVariables::DtoKey(IFDSUnitializedVariables::d_t d) const {
+  return getValueKey(d);
+}
+
+IFDSUnitializedVariables::d_t
+IFDSUnitializedVariables::KeytoD(const string &key) {
+  return getValueFromKey(icfg.getMethod(EntryPoints.front())->getParent(),
+                         key);
+}
+
 string
 IFDSUnitializedVariables::NtoString(IFDSUnitializedVariables::n_t n) const {
   return llvmIRToString(n);
@@ -12,13 +12,65 @@ using namespace std;
 using namespace psr;
 namespace psr {
 
+const map<string, WorkListStrategy> StringToWorkListStrategy = {
+    {"FIFO", WorkListStrategy::FIFO},
+    {"LIFO", WorkListStrategy::LIFO},
+    {"ReversePostOrder", WorkListStrategy::ReversePostOrder},
+    {"CalleeFirst", WorkListStrategy::CalleeFirst}};
+
+const map<WorkListStrategy, string> WorkListStrategyToString = {
+    {WorkListStrategy::FIFO, "FIFO"},
+    {WorkListStrategy::LIFO, "LIFO"},
+    {WorkListStrategy::ReversePostOrder, "ReversePostOrder"},
+    {WorkListStrategy::CalleeFirst, "CalleeFirst"}};
+
+ostream &operator<<(ostream &os, const WorkListStrategy &S) {
+  return os << WorkListStrategyToString.at(S);
+}
+
+const map<SolverStatus, string> SolverStatusToString = {
+    {SolverStatus::Unsolved, "Unsolved"},
+    {SolverStatus::Solved, "Solved"},
+    {SolverStatus::Cancelled, "Cancelled"},
+    {SolverStatus::PathEdgeLimitReached, "PathEdgeLimitReached"},
+    {SolverStatus::MemoryLimitReached, "MemoryLimitReached"},
+    {SolverStatus::TimeLimitReached, "TimeLimitReached"}};
+
+ostream &operator<<(ostream &os, const SolverStatus &S) {
+  return os << SolverStatusToString.at(S);
+}
+
 ostream &operator<<(ostream &os, const SolverConfiguration &sc) {
   return os << "SolverConfiguration:\n"
             << "\tfollowReturnsPastSeeds: " << sc.followReturnsPastSeeds << "\n"
             << "\tautoAddZero: " << sc.autoAddZero << "\n"
             << "\tcomputeValues: " << sc.computeValues << "\n"
             << "\trecordEdges: " << sc.recordEdges << "\n"
-            << "\tcomputePersistedSummaries: " << sc.computePersistedSummaries;
+            << "\tcomputePersistedSummaries: " << sc.computePersistedSummaries
+            << "\n"
+            << "\tcomputeValuesLazily: " << sc.computeValuesLazily << "\n"
+            << "\tblockwisePropagation: " << sc.blockwisePropagation << "\n"
+            << "\tsparsePropagation: " << sc.sparsePropagation << "\n"
+            << "\tbatchFlowFunctions: " << sc.batchFlowFunctions << "\n"
+            << "\tworkListStrategy: " << sc.workListStrategy << "\n"
+            << "\tnumThreads: " << sc.numThreads << "\n"
+            << "\tedgeFunctionCacheSize: " << sc.edgeFunctionCacheSize << "\n"
+            << "\tflowEdgeFunctionCacheSize: " << sc.flowEdgeFunctionCacheSize
+            << "\n"
+            << "\tjumpFunctionGCInterval: " << sc.jumpFunctionGCInterval
+            << "\n"
+            << "\tendSummaryPublishInterval: " << sc.endSummaryPublishInterval
+            << "\n"
+            << "\tmaxInMemoryJumpFunctions: " << sc.maxInMemoryJumpFunctions
+            << "\n"
+            << "\tspillDirectory: " << sc.spillDirectory << "\n"
+            << "\tmaxPathEdges: " << sc.maxPathEdges << "\n"
+            << "\tmaxResidentMemoryMB: " << sc.maxResidentMemoryMB << "\n"
+            << "\tmaxSolvingSeconds: " << sc.maxSolvingSeconds << "\n"
+            << "\tcancelled: " << sc.cancellationToken.isCancelled() << "\n"
+            << "\tcheckpointFile: " << sc.checkpointFile << "\n"
+            << "\tcheckpointInterval: " << sc.checkpointInterval << "\n"
+            << "\tpersistedSummariesFile: " << sc.persistedSummariesFile;
 }
 
 } // namespace psr
@@ -19,31 +19,30 @@ using namespace std;
 using namespace psr;
 namespace psr {
 
-size_t ValueAnnotationPass::unique_value_id = 0;
+std::atomic<size_t> ValueAnnotationPass::unique_value_id(0);
 
 bool ValueAnnotationPass::runOnModule(llvm::Module &M) {
   auto &lg = lg::get();
   BOOST_LOG_SEV(lg, INFO) << "Running ValueAnnotationPass";
   for (auto &global : M.globals()) {
     llvm::MDNode *node = llvm::MDNode::get(
-        context, llvm::MDString::get(context, std::to_string(unique_value_id)));
+        context,
+        llvm::MDString::get(context, std::to_string(unique_value_id++)));
     global.setMetadata(MetaDataKind, node);
     //		std::cout <<
     // llvm::cast<llvm::MDString>(global.getMetadata(MetaDataKind)->getOperand(0))->getString().str()
     //<< std::endl;
-    ++unique_value_id;
   }
   for (auto &F : M) {
     for (auto &BB : F) {
       for (auto &I : BB) {
         llvm::MDNode *node = llvm::MDNode::get(
             context,
-            llvm::MDString::get(context, std::to_string(unique_value_id)));
+            llvm::MDString::get(context, std::to_string(unique_value_id++)));
         I.setMetadata(MetaDataKind, node);
         //		    	std::cout <<
         // llvm::cast<llvm::MDString>(I.getMetadata(MetaDataKind)->getOperand(0))->getString().str()
         //<< std::endl;
-        ++unique_value_id;
       }
     }
   }
@@ -146,14 +146,18 @@ set<string> LLVMTypeHierarchy::getTransitivelyReachableTypes(string TypeName) {
   uniformTypeName(TypeName);
 
   set<string> reachable_nodes;
+  auto Type = type_vertex_map.find(TypeName);
+  if (Type == type_vertex_map.end()) {
+    return reachable_nodes;
+  }
   bidigraph_t tc;
   boost::transitive_closure(g, tc);
 
   // get all out edges of queried type
   typename boost::graph_traits<bidigraph_t>::out_edge_iterator ei, ei_end;
 
-  reachable_nodes.insert(g[type_vertex_map[TypeName]].name);
-  for (tie(ei, ei_end) = boost::out_edges(type_vertex_map[TypeName], tc);
+  reachable_nodes.insert(g[Type->second].name);
+  for (tie(ei, ei_end) = boost::out_edges(Type->second, tc);
        ei != ei_end; ++ei) {
 
     auto source = boost::source(*ei, tc);
@@ -176,7 +180,11 @@ string LLVMTypeHierarchy::getVTableEntry(string TypeName, unsigned idx) {
 VTable LLVMTypeHierarchy::getVTable(string TypeName) {
   uniformTypeName(TypeName);
 
-  return vtable_map[TypeName];
+  auto iter = vtable_map.find(TypeName);
+  if (iter != vtable_map.end()) {
+    return iter->second;
+  }
+  return VTable();
 }
 
 bool LLVMTypeHierarchy::hasSuperType(string TypeName, string SuperTypeName) {
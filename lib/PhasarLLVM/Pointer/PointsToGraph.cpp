@@ -298,15 +298,20 @@ set<const llvm::Value *> PointsToGraph::getPointsToSet(const llvm::Value *V) {
   PAMM_FACTORY;
   INC_COUNTER("Calls to getPointsToSet");
   START_TIMER("Compute PointsToSet");
+  set<const llvm::Value *> result;
+  auto Vertex = value_vertex_map.find(V);
+  if (Vertex == value_vertex_map.end()) {
+    PAUSE_TIMER("Compute PointsToSet");
+    return result;
+  }
   set<vertex_t> reachable_vertices;
   reachability_dfs_visitor vis(reachable_vertices);
   vector<boost::default_color_type> color_map(boost::num_vertices(ptg));
   boost::depth_first_visit(
-      ptg, value_vertex_map[V], vis,
+      ptg, Vertex->second, vis,
       boost::make_iterator_property_map(color_map.begin(),
                                         boost::get(boost::vertex_index, ptg),
                                         color_map[0]));
-  set<const llvm::Value *> result;
   for (auto vertex : reachable_vertices) {
     result.insert(ptg[vertex].value);
   }
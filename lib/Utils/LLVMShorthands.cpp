@@ -14,7 +14,10 @@
  *      Author: philipp
  */
 
+#include <llvm/IR/InstIterator.h>
 #include <phasar/Utils/LLVMShorthands.h>
+#include <regex>
+#include <stdexcept>
 using namespace std;
 using namespace psr;
 
@@ -193,6 +196,31 @@ std::size_t computeModuleHash(const llvm::Module *M) {
   return std::hash<std::string>{}(SourceCode);
 }
 
+std::size_t computeFunctionHash(const llvm::Function *F) {
+  std::string SourceCode;
+  llvm::raw_string_ostream RSO(SourceCode);
+  F->print(RSO);
+  RSO.flush();
+  // drop metadata attachments, e.g. '!psr.id !42', and the numbers of
+  // metadata nodes, both depend on the rest of the module
+  static const regex Attachment(",? ![A-Za-z_.][A-Za-z0-9_.-]* ![0-9]+");
+  static const regex MetadataNode("![0-9]+");
+  SourceCode = regex_replace(SourceCode, Attachment, "");
+  SourceCode = regex_replace(SourceCode, MetadataNode, "!");
+  return std::hash<std::string>{}(SourceCode);
+}
+
+std::map<std::string, std::size_t>
+computeFunctionHashes(const llvm::Module *M) {
+  std::map<std::string, std::size_t> Hashes;
+  for (auto &F : *M) {
+    if (!F.isDeclaration()) {
+      Hashes[F.getName().str()] = computeFunctionHash(&F);
+    }
+  }
+  return Hashes;
+}
+
 const llvm::TerminatorInst *getNthTermInstruction(const llvm::Function *F,
                                                   unsigned termInstNo) {
   unsigned current = 1;
@@ -224,4 +252,54 @@ const llvm::StoreInst *getNthStoreInstruction(const llvm::Function *F,
   return nullptr;
 }
 
+std::string getValueKey(const llvm::Value *V) {
+  if (isLLVMZeroValue(V)) {
+    return "zero";
+  }
+  if (auto GV = llvm::dyn_cast<llvm::GlobalValue>(V)) {
+    return "g:" + GV->getName().str();
+  }
+  if (auto A = llvm::dyn_cast<llvm::Argument>(V)) {
+    return "a:" + std::to_string(A->getArgNo()) + ":" +
+           A->getParent()->getName().str();
+  }
+  if (auto I = llvm::dyn_cast<llvm::Instruction>(V)) {
+    unsigned idx = 1;
+    for (auto &Inst : llvm::instructions(I->getFunction())) {
+      if (&Inst == I) {
+        break;
+      }
+      ++idx;
+    }
+    return "i:" + std::to_string(idx) + ":" +
+           I->getFunction()->getName().str();
+  }
+  throw std::runtime_error("Value has no key: " + llvmIRToString(V));
+}
+
+const llvm::Value *getValueFromKey(const llvm::Module *M,
+                                   const std::string &Key) {
+  if (Key == "zero") {
+    return LLVMZeroValue::getInstance();
+  }
+  const llvm::Value *V = nullptr;
+  if (Key.compare(0, 2, "g:") == 0) {
+    V = M->getNamedValue(Key.substr(2));
+  } else if (Key.compare(0, 2, "a:") == 0 || Key.compare(0, 2, "i:") == 0) {
+    size_t sep = Key.find(':', 2);
+    if (sep != std::string::npos) {
+      unsigned no = std::stoul(Key.substr(2, sep - 2));
+      if (const llvm::Function *F = M->getFunction(Key.substr(sep + 1))) {
+        V = (Key[0] == 'a') ? static_cast<const llvm::Value *>(
+                                  getNthFunctionArgument(F, no))
+                            : getNthInstruction(F, no);
+      }
+    }
+  }
+  if (!V) {
+    throw std::runtime_error("No value with key " + Key);
+  }
+  return V;
+}
+
 } // namespace psr
@@ -230,6 +230,10 @@ int main(int argc, const char **argv) {
 			("wpa,W", bpo::value<bool>()->default_value(1), "Whole-program analysis mode (1 or 0)")
 			("mem2reg,M", bpo::value<bool>()->default_value(1), "Promote memory to register pass (1 or 0)")
 			("printedgerec,R", bpo::value<bool>()->default_value(0), "Print exploded-super-graph edge recorder (1 or 0)")
+			("fuse_analyses,U", bpo::value<bool>()->default_value(0), "Solve the chosen IFDS analyses in a single pass (1 or 0)")
+			("analysis_threads,T", bpo::value<unsigned>()->default_value(1), "Number of threads on which the chosen analyses run concurrently")
+			("entry_point_groups,G", bpo::value<unsigned>()->default_value(0), "Solve the chosen IFDS analyses for groups of this many entry points in solver instances that share end summaries (0 to solve all entry points together)")
+			("entry_point_threads", bpo::value<unsigned>()->default_value(1), "Number of threads on which the groups of entry points of each analysis are solved concurrently")
       #ifdef PHASAR_PLUGINS_ENABLED
 			("analysis_plugin", bpo::value<std::vector<std::string>>()->notifier(validateParamAnalysisPlugin), "Analysis plugin(s) (absolute path to the shared object file(s))")
       ("callgraph_plugin", bpo::value<std::string>()->notifier(validateParamICFGPlugin), "ICFG plugin (absolute path to the shared object file)")
@@ -352,6 +356,24 @@ int main(int argc, const char **argv) {
           std::cout << "Print edge recorder: "
                     << VariablesMap["printedgerec"].as<bool>() << '\n';
         }
+        if (VariablesMap.count("fuse_analyses")) {
+          std::cout << "Fuse analyses: "
+                    << VariablesMap["fuse_analyses"].as<bool>() << '\n';
+        }
+        if (VariablesMap.count("analysis_threads")) {
+          std::cout << "Analysis threads: "
+                    << VariablesMap["analysis_threads"].as<unsigned>() << '\n';
+        }
+        if (VariablesMap.count("entry_point_groups")) {
+          std::cout << "Entry point groups: "
+                    << VariablesMap["entry_point_groups"].as<unsigned>()
+                    << '\n';
+        }
+        if (VariablesMap.count("entry_point_threads")) {
+          std::cout << "Entry point threads: "
+                    << VariablesMap["entry_point_threads"].as<unsigned>()
+                    << '\n';
+        }
         if (VariablesMap.count("analysis_plugin")) {
           std::cout << "Analysis plugin(s): \n";
           for (const auto &analysis_plugin :
@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <phasar/PhasarLLVM/IfdsIde/EdgeFunctionFactory.h>
+#include <phasar/PhasarLLVM/IfdsIde/EdgeFunctions/EdgeIdentity.h>
+
+using namespace psr;
+
+// x -> x + Offset
+class AddOffset : public EdgeFunction<int>,
+                  public std::enable_shared_from_this<AddOffset> {
+public:
+  const int Offset;
+  AddOffset(int Offset) : Offset(Offset) {}
+  int computeTarget(int Source) override { return Source + Offset; }
+  std::shared_ptr<EdgeFunction<int>>
+  composeWith(std::shared_ptr<EdgeFunction<int>> SecondFunction) override {
+    if (auto *Other = dynamic_cast<AddOffset *>(SecondFunction.get())) {
+      return std::make_shared<AddOffset>(Offset + Other->Offset);
+    }
+    return SecondFunction;
+  }
+  std::shared_ptr<EdgeFunction<int>>
+  joinWith(std::shared_ptr<EdgeFunction<int>> OtherFunction) override {
+    if (auto *Other = dynamic_cast<AddOffset *>(OtherFunction.get())) {
+      return std::make_shared<AddOffset>(std::max(Offset, Other->Offset));
+    }
+    return shared_from_this();
+  }
+  bool equalTo(std::shared_ptr<EdgeFunction<int>> Other) override {
+    auto *O = dynamic_cast<AddOffset *>(Other.get());
+    return O && O->Offset == Offset;
+  }
+  size_t hash() override { return std::hash<int>()(Offset); }
+};
+
+// x -> x * Factor, does not override hash()
+class MulFactor : public EdgeFunction<int>,
+                  public std::enable_shared_from_this<MulFactor> {
+public:
+  const int Factor;
+  MulFactor(int Factor) : Factor(Factor) {}
+  int computeTarget(int Source) override { return Source * Factor; }
+  std::shared_ptr<EdgeFunction<int>>
+  composeWith(std::shared_ptr<EdgeFunction<int>> SecondFunction) override {
+    if (auto *Other = dynamic_cast<MulFactor *>(SecondFunction.get())) {
+      return std::make_shared<MulFactor>(Factor * Other->Factor);
+    }
+    return SecondFunction;
+  }
+  std::shared_ptr<EdgeFunction<int>>
+  joinWith(std::shared_ptr<EdgeFunction<int>> OtherFunction) override {
+    return shared_from_this();
+  }
+  bool equalTo(std::shared_ptr<EdgeFunction<int>> Other) override {
+    auto *O = dynamic_cast<MulFactor *>(Other.get());
+    return O && O->Factor == Factor;
+  }
+};
+
+TEST(EdgeFunctionFactoryTest, HandleHashConsing) {
+  EdgeFunctionFactory<int> F;
+  auto A = F.make<AddOffset>(1);
+  auto B = F.make<AddOffset>(1);
+  auto C = F.make<AddOffset>(2);
+  EXPECT_EQ(A, B);
+  EXPECT_NE(A, C);
+  EXPECT_EQ(F.intern(std::make_shared<AddOffset>(2)), C);
+  EXPECT_EQ(F.size(), 2u);
+}
+
+TEST(EdgeFunctionFactoryTest, HandleSharedHashValues) {
+  EdgeFunctionFactory<int> F;
+  auto Two = F.make<MulFactor>(2);
+  auto Three = F.make<MulFactor>(3);
+  EXPECT_NE(Two, Three);
+  EXPECT_EQ(F.make<MulFactor>(3), Three);
+  EXPECT_EQ(Three->computeTarget(2), 6);
+  EXPECT_EQ(F.size(), 2u);
+}
+
+TEST(EdgeFunctionFactoryTest, HandleMemoization) {
+  EdgeFunctionFactory<int> F;
+  auto One = F.make<AddOffset>(1);
+  auto Two = F.make<AddOffset>(2);
+  auto Composed = F.compose(One, One);
+  EXPECT_EQ(Composed, Two);
+  EXPECT_EQ(F.compose(One, One), Composed);
+  EXPECT_EQ(F.getMemoHits(), 1u);
+  EXPECT_EQ(F.join(One, Two), Two);
+  EXPECT_EQ(F.compose(F.intern(EdgeIdentity<int>::getInstance()), Two), Two);
+}
+
+TEST(EdgeFunctionFactoryTest, HandleOwnership) {
+  EdgeFunctionFactory<int> F;
+  auto Three = F.intern(std::make_shared<AddOffset>(3));
+  // the factory holds the only owning pointer, references do not count
+  auto Copy = Three;
+  EXPECT_EQ(Copy.ptr().use_count(), 1);
+  EXPECT_EQ(Copy->computeTarget(1), 4);
+}
+
+TEST(EdgeFunctionFactoryTest, HandleDisabledMemoization) {
+  EdgeFunctionFactory<int> F(0);
+  auto One = F.make<AddOffset>(1);
+  EXPECT_EQ(F.compose(One, One), F.compose(One, One));
+  EXPECT_EQ(F.getMemoHits(), 0u);
+  EXPECT_EQ(F.getMemoMisses(), 2u);
+}
+
+// main function for the test case
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+#include <llvm/IR/InstIterator.h>
+#include <phasar/DB/ProjectIRDB.h>
+#include <phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h>
+#include <phasar/PhasarLLVM/IfdsIde/Problems/IFDSConstAnalysis.h>
+#include <phasar/PhasarLLVM/IfdsIde/Solver/BitVectorIFDSSolver.h>
+#include <phasar/PhasarLLVM/IfdsIde/Solver/LLVMIFDSSolver.h>
+#include <phasar/PhasarLLVM/Pointer/LLVMTypeHierarchy.h>
+
+using namespace psr;
+
+/* ============== TEST FIXTURE ============== */
+
+class BitVectorIFDSSolverTest : public ::testing::Test {
+protected:
+  const std::string pathToTests =
+      "../../../../../test/llvm_test_code/constness/";
+  const std::vector<std::string> EntryPoints = {"main"};
+
+  using Results = std::map<const llvm::Instruction *,
+                           std::set<const llvm::Value *>>;
+
+  ProjectIRDB *IRDB;
+  LLVMTypeHierarchy *TH;
+  LLVMBasedICFG *ICFG;
+
+  BitVectorIFDSSolverTest() {}
+  virtual ~BitVectorIFDSSolverTest() {}
+
+  void SetUp(const std::vector<std::string> &IRFiles) {
+    initializeLogger(false);
+    ValueAnnotationPass::resetValueID();
+    IRDB = new ProjectIRDB(IRFiles);
+    IRDB->preprocessIR();
+    TH = new LLVMTypeHierarchy(*IRDB);
+    ICFG = new LLVMBasedICFG(*TH, *IRDB, WalkerStrategy::Pointer,
+                             ResolveStrategy::OTF, EntryPoints);
+  }
+
+  virtual void TearDown() override {
+    PAMM_FACTORY;
+    delete IRDB;
+    delete TH;
+    delete ICFG;
+    PAMM_RESET;
+  }
+
+  // returns the facts that the given solver computed at each instruction
+  template <typename SolverTy> Results collectResults(SolverTy &Solver) {
+    Results Facts;
+    for (auto M : IRDB->getAllModules()) {
+      for (auto &F : *M) {
+        for (auto &I : llvm::instructions(F)) {
+          auto ResultsAt = Solver.ifdsResultsAt(&I);
+          if (!ResultsAt.empty()) {
+            Facts[&I] = ResultsAt;
+          }
+        }
+      }
+    }
+    return Facts;
+  }
+
+  // solves the constness analysis with both solvers, each on a problem of its
+  // own as the problem tracks the initialized memory locations
+  void compareSolvers(const std::string &IRFile) {
+    SetUp({pathToTests + IRFile});
+    IFDSConstAnalysis ConstProblem(*ICFG, EntryPoints);
+    LLVMIFDSSolver<const llvm::Value *, LLVMBasedICFG &> ConstSolver(
+        ConstProblem, false);
+    ConstSolver.solve();
+    IFDSConstAnalysis BitVectorProblem(*ICFG, EntryPoints);
+    BitVectorIFDSSolver<const llvm::Instruction *, const llvm::Value *,
+                        const llvm::Function *, LLVMBasedICFG &>
+        BitVectorSolver(BitVectorProblem);
+    BitVectorSolver.solve();
+    Results Expected = collectResults(ConstSolver);
+    EXPECT_FALSE(Expected.empty());
+    EXPECT_EQ(Expected, collectResults(BitVectorSolver));
+  }
+};
+
+TEST_F(BitVectorIFDSSolverTest, HandleBasicTest_01) {
+  compareSolvers("basic/basic_01.ll");
+}
+
+TEST_F(BitVectorIFDSSolverTest, HandleBasicTest_02) {
+  compareSolvers("basic/basic_02.ll");
+}
+
+TEST_F(BitVectorIFDSSolverTest, HandleBasicTest_03) {
+  compareSolvers("basic/basic_03.ll");
+}
+
+TEST_F(BitVectorIFDSSolverTest, HandleBasicTest_04) {
+  compareSolvers("basic/basic_04.ll");
+}
+
+TEST_F(BitVectorIFDSSolverTest, HandleCFForTest_01) {
+  compareSolvers("control_flow/cf_for_01.ll");
+}
+
+TEST_F(BitVectorIFDSSolverTest, HandleCFForTest_02) {
+  compareSolvers("control_flow/cf_for_02.ll");
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
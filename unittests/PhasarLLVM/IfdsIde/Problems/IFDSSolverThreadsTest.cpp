@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+#include <llvm/IR/InstIterator.h>
+#include <phasar/DB/ProjectIRDB.h>
+#include <phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h>
+#include <phasar/PhasarLLVM/IfdsIde/Problems/IFDSTaintAnalysis.h>
+#include <phasar/PhasarLLVM/IfdsIde/Solver/LLVMIFDSSolver.h>
+#include <phasar/PhasarLLVM/Pointer/LLVMTypeHierarchy.h>
+
+using namespace psr;
+
+/* ============== TEST FIXTURE ============== */
+
+class IFDSSolverThreadsTest : public ::testing::Test {
+protected:
+  const std::string pathToTests = "../../../../../test/llvm_test_code/";
+  const std::vector<std::string> EntryPoints = {"main"};
+
+  using Results = std::map<const llvm::Instruction *,
+                           std::set<const llvm::Value *>>;
+
+  ProjectIRDB *IRDB;
+  LLVMTypeHierarchy *TH;
+  LLVMBasedICFG *ICFG;
+
+  IFDSSolverThreadsTest() {}
+  virtual ~IFDSSolverThreadsTest() {}
+
+  void SetUp(const std::vector<std::string> &IRFiles) {
+    initializeLogger(false);
+    IRDB = new ProjectIRDB(IRFiles);
+    IRDB->preprocessIR();
+    TH = new LLVMTypeHierarchy(*IRDB);
+    ICFG = new LLVMBasedICFG(*TH, *IRDB, WalkerStrategy::Pointer,
+                             ResolveStrategy::OTF, EntryPoints);
+  }
+
+  virtual void TearDown() override {
+    delete IRDB;
+    delete TH;
+    delete ICFG;
+  }
+
+  // solves the taint analysis on the given number of threads, returns the
+  // facts at each instruction and the leaks
+  std::pair<Results, Results> solveTaint(unsigned NumThreads) {
+    IFDSTaintAnalysis TaintProblem(*ICFG, EntryPoints);
+    TaintProblem.solver_config.numThreads = NumThreads;
+    LLVMIFDSSolver<const llvm::Value *, LLVMBasedICFG &> TaintSolver(
+        TaintProblem, false);
+    TaintSolver.solve();
+    Results Facts;
+    for (auto M : IRDB->getAllModules()) {
+      for (auto &F : *M) {
+        for (auto &I : llvm::instructions(F)) {
+          auto ResultsAt = TaintSolver.ifdsResultsAt(&I);
+          if (!ResultsAt.empty()) {
+            Facts[&I] = ResultsAt;
+          }
+        }
+      }
+    }
+    return {Facts, TaintProblem.Leaks};
+  }
+
+  void compareThreads(const std::string &IRFile) {
+    SetUp({pathToTests + IRFile});
+    auto Sequential = solveTaint(1);
+    for (unsigned NumThreads : {2, 4, 8}) {
+      auto Parallel = solveTaint(NumThreads);
+      EXPECT_EQ(Sequential.first, Parallel.first);
+      EXPECT_EQ(Sequential.second, Parallel.second);
+    }
+  }
+};
+
+TEST_F(IFDSSolverThreadsTest, HandleFunctionCall) {
+  compareThreads("control_flow/function_call.ll");
+}
+
+TEST_F(IFDSSolverThreadsTest, HandleTaint_01) {
+  compareThreads("taint_analysis/taint_1.ll");
+}
+
+TEST_F(IFDSSolverThreadsTest, HandleTaint_02) {
+  compareThreads("taint_analysis/taint_2.ll");
+}
+
+TEST_F(IFDSSolverThreadsTest, HandleTaint_03) {
+  compareThreads("taint_analysis/taint_3.ll");
+}
+
+TEST_F(IFDSSolverThreadsTest, HandleTaint_04) {
+  compareThreads("taint_analysis/taint_4.ll");
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+#include <phasar/Utils/BinaryIO.h>
+#include <sstream>
+
+using namespace psr;
+
+TEST(BinaryIOTest, HandleRoundTrip) {
+  std::stringstream Stream;
+  BinaryWriter Writer(Stream);
+  const uint64_t Ints[] = {0, 1, 127, 128, 300, 1ull << 32, ~0ull};
+  for (uint64_t I : Ints) {
+    Writer.writeInt(I);
+  }
+  Writer.writeString("");
+  Writer.writeString(std::string("a\0b", 3));
+  Writer.writeString(std::string(10000, 'x'));
+  BinaryReader Reader(Stream);
+  for (uint64_t I : Ints) {
+    EXPECT_EQ(Reader.readInt(), I);
+  }
+  EXPECT_EQ(Reader.readString(), "");
+  EXPECT_EQ(Reader.readString(), std::string("a\0b", 3));
+  EXPECT_EQ(Reader.readString(), std::string(10000, 'x'));
+  EXPECT_TRUE(Reader.atEnd());
+}
+
+TEST(BinaryIOTest, HandleSmallIntsCompactly) {
+  std::stringstream Stream;
+  BinaryWriter Writer(Stream);
+  Writer.writeInt(127);
+  EXPECT_EQ(Stream.str().size(), 1u);
+  Writer.writeInt(128);
+  EXPECT_EQ(Stream.str().size(), 3u);
+}
+
+TEST(BinaryIOTest, HandleTruncatedInput) {
+  std::stringstream Stream;
+  BinaryWriter Writer(Stream);
+  Writer.writeString("truncated");
+  std::string Data = Stream.str();
+  std::stringstream Truncated(Data.substr(0, Data.size() - 1));
+  BinaryReader Reader(Truncated);
+  EXPECT_THROW(Reader.readString(), std::runtime_error);
+  std::stringstream Empty;
+  BinaryReader EmptyReader(Empty);
+  EXPECT_THROW(EmptyReader.readInt(), std::runtime_error);
+}
+
+// main function for the test case
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
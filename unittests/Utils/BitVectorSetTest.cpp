@@ -0,0 +1,51 @@
+#include <gtest/gtest.h>
+#include <phasar/Utils/BitVectorSet.h>
+#include <vector>
+
+using namespace psr;
+
+TEST(BitVectorSetTest, HandleInsertAndErase) {
+  BitVectorSet S;
+  EXPECT_TRUE(S.empty());
+  EXPECT_TRUE(S.insert(3));
+  EXPECT_TRUE(S.insert(130));
+  EXPECT_FALSE(S.insert(3));
+  EXPECT_TRUE(S.count(3));
+  EXPECT_TRUE(S.count(130));
+  EXPECT_FALSE(S.count(64));
+  EXPECT_FALSE(S.count(1000));
+  EXPECT_EQ(S.size(), 2u);
+  S.erase(3);
+  S.erase(1000);
+  EXPECT_FALSE(S.count(3));
+  EXPECT_EQ(S.size(), 1u);
+}
+
+TEST(BitVectorSetTest, HandleSetOperations) {
+  BitVectorSet A, B, Added;
+  A.insert(1);
+  A.insert(70);
+  B.insert(1);
+  B.insert(200);
+  EXPECT_TRUE(A.unionWith(B, &Added));
+  EXPECT_FALSE(A.unionWith(B));
+  EXPECT_EQ(A.size(), 3u);
+  EXPECT_EQ(Added.size(), 1u);
+  EXPECT_TRUE(Added.count(200));
+  A.subtract(B);
+  std::vector<uint32_t> Ids;
+  A.forEach([&Ids](uint32_t Id) { Ids.push_back(Id); });
+  EXPECT_EQ(Ids, std::vector<uint32_t>{70});
+  BitVectorSet C;
+  C.insert(70);
+  C.insert(300);
+  C.erase(300);
+  EXPECT_EQ(A, C);
+  EXPECT_NE(A, B);
+}
+
+// main function for the test case
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
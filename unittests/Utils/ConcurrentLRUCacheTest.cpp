@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+#include <phasar/Utils/ConcurrentLRUCache.h>
+#include <thread>
+#include <vector>
+
+using namespace psr;
+
+TEST(ConcurrentLRUCacheTest, HandleHitsAndMisses) {
+  ConcurrentLRUCache<int, int> Cache;
+  unsigned Computations = 0;
+  auto Square = [&](int X) {
+    return Cache.getOrCompute(X, [&] {
+      ++Computations;
+      return X * X;
+    });
+  };
+  EXPECT_EQ(Square(3), 9);
+  EXPECT_EQ(Square(3), 9);
+  EXPECT_EQ(Square(4), 16);
+  EXPECT_EQ(Computations, 2u);
+  EXPECT_EQ(Cache.getHits(), 1u);
+  EXPECT_EQ(Cache.getMisses(), 2u);
+  EXPECT_EQ(Cache.size(), 2u);
+  Cache.clear();
+  EXPECT_EQ(Cache.size(), 0u);
+  EXPECT_EQ(Square(3), 9);
+  EXPECT_EQ(Computations, 3u);
+}
+
+TEST(ConcurrentLRUCacheTest, HandleLeastRecentlyUsedEviction) {
+  ConcurrentLRUCache<int, int> Cache(2);
+  auto Lookup = [&](int X) { return Cache.getOrCompute(X, [&] { return X; }); };
+  Lookup(1);
+  Lookup(2);
+  // 1 becomes the most recently used entry, hence, 2 is evicted
+  Lookup(1);
+  Lookup(3);
+  EXPECT_EQ(Cache.size(), 2u);
+  EXPECT_EQ(Cache.getEvictions(), 1u);
+  size_t Misses = Cache.getMisses();
+  Lookup(1);
+  EXPECT_EQ(Cache.getMisses(), Misses);
+  Lookup(2);
+  EXPECT_EQ(Cache.getMisses(), Misses + 1);
+}
+
+TEST(ConcurrentLRUCacheTest, HandleConcurrentLookups) {
+  ConcurrentLRUCache<int, int> Cache(64, 8);
+  std::vector<std::thread> Threads;
+  std::vector<int> Failures(4, 0);
+  for (int T = 0; T < 4; ++T) {
+    Threads.emplace_back([&, T] {
+      for (int I = 0; I < 10000; ++I) {
+        int X = (I * 7 + T) % 200;
+        if (Cache.getOrCompute(X, [&] { return X + 1; }) != X + 1) {
+          ++Failures[T];
+        }
+      }
+    });
+  }
+  for (auto &Thread : Threads) {
+    Thread.join();
+  }
+  for (int F : Failures) {
+    EXPECT_EQ(F, 0);
+  }
+  EXPECT_EQ(Cache.getHits() + Cache.getMisses(), 40000u);
+  EXPECT_LE(Cache.size(), 64u);
+}
+
+// main function for the test case
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
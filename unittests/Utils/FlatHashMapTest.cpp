@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+#include <map>
+#include <phasar/Utils/FlatHashMap.h>
+#include <random>
+
+using namespace psr;
+
+TEST(FlatHashMapTest, HandleInsertAndFind) {
+  FlatHashMap<uint64_t, unsigned> Map;
+  EXPECT_TRUE(Map.empty());
+  EXPECT_EQ(Map.find(42), nullptr);
+  EXPECT_TRUE(Map.insert(42, 1).second);
+  EXPECT_FALSE(Map.insert(42, 2).second);
+  EXPECT_EQ(*Map.find(42), 1u);
+  *Map.find(42) = 3;
+  EXPECT_EQ(*Map.find(42), 3u);
+  EXPECT_EQ(Map.size(), 1u);
+}
+
+TEST(FlatHashMapTest, HandleEraseAgainstStdMap) {
+  FlatHashMap<uint64_t, uint64_t> Map;
+  std::map<uint64_t, uint64_t> Expected;
+  std::mt19937 Rand(7);
+  for (unsigned I = 0; I < 100000; ++I) {
+    // few distinct keys to provoke long probe sequences and many erasures
+    uint64_t Key = Rand() % 2048;
+    if (Rand() % 3 == 0) {
+      EXPECT_EQ(Map.erase(Key), Expected.erase(Key) == 1);
+    } else {
+      EXPECT_EQ(Map.insert(Key, I).second, Expected.emplace(Key, I).second);
+    }
+  }
+  EXPECT_EQ(Map.size(), Expected.size());
+  for (uint64_t Key = 0; Key < 2048; ++Key) {
+    auto Search = Expected.find(Key);
+    if (Search == Expected.end()) {
+      EXPECT_EQ(Map.find(Key), nullptr);
+    } else {
+      ASSERT_NE(Map.find(Key), nullptr);
+      EXPECT_EQ(*Map.find(Key), Search->second);
+    }
+  }
+  size_t Visited = 0;
+  Map.forEach([&](uint64_t Key, uint64_t Value) {
+    EXPECT_EQ(Expected[Key], Value);
+    ++Visited;
+  });
+  EXPECT_EQ(Visited, Expected.size());
+}
+
+// main function for the test case
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
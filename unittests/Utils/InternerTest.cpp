@@ -0,0 +1,51 @@
+#include <gtest/gtest.h>
+#include <phasar/Utils/Interner.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace psr;
+
+TEST(InternerTest, HandleDenseIds) {
+  Interner<std::string> I;
+  EXPECT_EQ(I.getOrCreateId("foo"), 0u);
+  EXPECT_EQ(I.getOrCreateId("bar"), 1u);
+  EXPECT_EQ(I.getOrCreateId("foo"), 0u);
+  EXPECT_EQ(I.getId("bar"), 1u);
+  EXPECT_EQ(I.getId("baz"), Interner<std::string>::InvalidId);
+  EXPECT_EQ(I.get(0), "foo");
+  EXPECT_EQ(I.get(1), "bar");
+  EXPECT_EQ(I.size(), 2u);
+}
+
+TEST(InternerTest, HandlePackedIds) {
+  uint64_t Key = packIds(42, 13);
+  EXPECT_EQ(unpackFirstId(Key), 42u);
+  EXPECT_EQ(unpackSecondId(Key), 13u);
+  EXPECT_NE(packIds(1, 2), packIds(2, 1));
+}
+
+TEST(InternerTest, HandleConcurrentInterning) {
+  Interner<int> I(8);
+  std::vector<std::thread> Threads;
+  for (int T = 0; T < 4; ++T) {
+    Threads.emplace_back([&I]() {
+      for (int V = 0; V < 100000; ++V) {
+        I.getOrCreateId(V);
+      }
+    });
+  }
+  for (auto &T : Threads) {
+    T.join();
+  }
+  EXPECT_EQ(I.size(), 100000u);
+  for (int V = 0; V < 100000; ++V) {
+    EXPECT_EQ(I.get(I.getId(V)), V);
+  }
+}
+
+// main function for the test case
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
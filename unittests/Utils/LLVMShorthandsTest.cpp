@@ -32,6 +32,31 @@ TEST(LLVMGetterTest, HandlesLLVMTermInstruction) {
   ASSERT_EQ(getNthTermInstruction(F, 5), nullptr);
 }
 
+TEST(LLVMGetterTest, HandlesValueKeys) {
+  ProjectIRDB IRDB(
+      {"../../../test/llvm_test_code/control_flow/global_stmt.ll"});
+  auto F = IRDB.getFunction("main");
+  auto M = F->getParent();
+  std::vector<const llvm::Value *> Values{LLVMZeroValue::getInstance(), F};
+  for (auto &G : M->globals()) {
+    Values.push_back(&G);
+  }
+  for (auto &A : F->args()) {
+    Values.push_back(&A);
+  }
+  for (auto &BB : *F) {
+    for (auto &I : BB) {
+      Values.push_back(&I);
+    }
+  }
+  for (auto V : Values) {
+    ASSERT_EQ(getValueFromKey(M, getValueKey(V)), V);
+  }
+  ASSERT_EQ(getValueKey(getNthInstruction(F, 4)), "i:4:main");
+  ASSERT_THROW(getValueFromKey(M, "i:1000:main"), std::runtime_error);
+  ASSERT_THROW(getValueFromKey(M, "g:no_such_global"), std::runtime_error);
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
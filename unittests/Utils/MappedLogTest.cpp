@@ -0,0 +1,39 @@
+#include <gtest/gtest.h>
+#include <phasar/Utils/MappedLog.h>
+#include <vector>
+
+using namespace psr;
+
+struct Record {
+  int Key;
+  double Value;
+};
+
+TEST(MappedLogTest, HandleAppend) {
+  MappedLog<Record> Log;
+  EXPECT_TRUE(Log.empty());
+  EXPECT_EQ(Log.append(Record{1, 1.5}), 0u);
+  EXPECT_EQ(Log.append(Record{2, 2.5}), 1u);
+  EXPECT_EQ(Log.size(), 2u);
+  EXPECT_EQ(Log[0].Key, 1);
+  EXPECT_EQ(Log[1].Value, 2.5);
+}
+
+TEST(MappedLogTest, HandleGrowth) {
+  MappedLog<unsigned> Log;
+  std::vector<unsigned> Records(10000);
+  for (unsigned I = 0; I < Records.size(); ++I) {
+    Records[I] = I;
+  }
+  EXPECT_EQ(Log.append(Records.data(), Records.size()), 0u);
+  EXPECT_EQ(Log.append(Records.data(), Records.size()), 10000u);
+  for (unsigned I = 0; I < Log.size(); ++I) {
+    EXPECT_EQ(Log[I], I % 10000);
+  }
+}
+
+// main function for the test case
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+#include <phasar/Utils/SmallVectorSet.h>
+#include <random>
+#include <set>
+
+using namespace psr;
+
+TEST(SmallVectorSetTest, HandleInsertAndErase) {
+  SmallVectorSet<int, 4> Set;
+  EXPECT_TRUE(Set.empty());
+  EXPECT_TRUE(Set.insert(3).second);
+  EXPECT_TRUE(Set.insert(1).second);
+  EXPECT_FALSE(Set.insert(3).second);
+  EXPECT_EQ(*Set.insert(1).first, 1);
+  EXPECT_EQ(Set.size(), 2u);
+  EXPECT_EQ(Set.count(3), 1u);
+  EXPECT_EQ(Set.count(2), 0u);
+  // insertion order is kept
+  EXPECT_EQ(*Set.begin(), 3);
+  EXPECT_EQ(Set.erase(3), 1u);
+  EXPECT_EQ(Set.erase(3), 0u);
+  EXPECT_EQ(Set, (SmallVectorSet<int, 4>{1}));
+}
+
+TEST(SmallVectorSetTest, HandleRangesAgainstStdSet) {
+  std::mt19937 Rand(7);
+  for (unsigned Size : {0u, 3u, 20u, 100u, 1000u}) {
+    std::vector<int> Values;
+    for (unsigned I = 0; I < Size; ++I) {
+      // few distinct values to provoke duplicates
+      Values.push_back(Rand() % (Size / 2 + 1));
+    }
+    SmallVectorSet<int, 10> Set(Values.begin(), Values.end());
+    std::set<int> Expected(Values.begin(), Values.end());
+    EXPECT_EQ(Set.size(), Expected.size());
+    EXPECT_EQ(std::set<int>(Set.begin(), Set.end()), Expected);
+    Set.insert(Values.begin(), Values.end());
+    EXPECT_EQ(Set.size(), Expected.size());
+  }
+}
+
+TEST(SmallVectorSetTest, HandleSingleInsertsAgainstStdSet) {
+  std::mt19937 Rand(11);
+  SmallVectorSet<int, 10> Set;
+  std::set<int> Expected;
+  for (unsigned I = 0; I < 2000; ++I) {
+    int Value = Rand() % 500;
+    if (Rand() % 4 == 0) {
+      EXPECT_EQ(Set.erase(Value), Expected.erase(Value));
+    } else {
+      auto Inserted = Set.insert(Value);
+      EXPECT_EQ(Inserted.second, Expected.insert(Value).second);
+      EXPECT_EQ(*Inserted.first, Value);
+    }
+    EXPECT_EQ(Set.size(), Expected.size());
+    EXPECT_EQ(Set.count(Value), Expected.count(Value));
+  }
+  EXPECT_EQ(std::set<int>(Set.begin(), Set.end()), Expected);
+  // ranges into a large set
+  std::vector<int> Values{7, 1000, 3, 1001, 1000};
+  Set.insert(Values.begin(), Values.end());
+  Expected.insert(Values.begin(), Values.end());
+  EXPECT_EQ(std::set<int>(Set.begin(), Set.end()), Expected);
+  EXPECT_EQ(Set.size(), Expected.size());
+}
+
+TEST(SmallVectorSetTest, HandleEquality) {
+  SmallVectorSet<int, 2> A{1, 2, 3};
+  SmallVectorSet<int, 2> B{3, 1, 2};
+  SmallVectorSet<int, 2> C{1, 2};
+  EXPECT_EQ(A, B);
+  EXPECT_NE(A, C);
+}
+
+// main function for the test case
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}